@@ -20,6 +20,8 @@
 //  #include "ARMCM0.h"
 //#endif
 
+#include <string.h>
+
 #include "apps/aircopy/aircopy.h"
 #include "features/audio/audio.h"
 #include "drivers/bsp/bk4819.h"
@@ -28,6 +30,9 @@
 #include "features/radio/frequencies.h"
 #include "core/misc.h"
 #include "features/radio/radio.h"
+#ifdef ENABLE_AIRCOPY_V2
+#include "features/storage/storage_clone.h"
+#endif
 #include "ui/helper.h"
 #include "ui/inputbox.h"
 #include "ui/ui.h"
@@ -43,7 +48,64 @@ uint16_t gAirCopyBlockNumber;
 uint16_t gErrorsDuringAirCopy;
 uint8_t gAirCopyIsSendMode;
 
-uint16_t g_FSK_Buffer[36];
+uint16_t g_FSK_Buffer[AIRCOPY_FRAME_WORDS];
+
+#ifdef ENABLE_AIRCOPY_V2
+// v2 frame, 68 words: 0xABCD, header, 64 payload words, CRC, 0xDCBA
+//
+// header <15:12> frame type
+//        <11:8>  round
+//        <7:0>   chunk index (DATA), manifest page (MANIFEST),
+//                END frames still to come (END), missing chunks (NACK)
+//
+// The payload is a chunk of the record clone stream (storage_clone.h), so the
+// transfer covers every cloneable record and skips empty channels. Its length
+// follows the channel count; the first payload byte of every frame carries
+// the chunk count. The sender works in rounds: the chunks pending for the
+// round, then END twice, then it listens for NACKs carrying the receivers'
+// missing-chunk bitmaps. Those are ORed into the next round; a window without
+// NACKs ends the transfer. Delta mode opens with manifest pages of chunk CRCs
+// instead of data, receivers keep the chunks that already match and NACK the
+// rest.
+
+#define CHUNK_SIZE          CLONE_CHUNK_SIZE
+#define PAYLOAD_WORDS       (CHUNK_SIZE / 2U)
+#define MANIFEST_CRCS       (PAYLOAD_WORDS - 1U)
+#define GAUGE_BLOCKS        120U
+
+#define END_REPEAT          2
+#define FRAME_GAP_10ms      10      // lets the receiver store the chunk
+#define NACK_SLOTS          4
+#define NACK_SLOT_10ms      130     // one frame plus turnaround
+#define NACK_WINDOW_10ms    (NACK_SLOTS * NACK_SLOT_10ms + 50)
+#define MAX_ROUNDS          8
+
+enum {
+    FRAME_DATA = 0,
+    FRAME_MANIFEST,
+    FRAME_END,
+    FRAME_NACK
+};
+
+enum {
+    PHASE_IDLE = 0,
+    PHASE_MANIFEST,     // sender, delta mode
+    PHASE_DATA,         // sender
+    PHASE_END,          // sender
+    PHASE_LISTEN,       // sender, collecting NACKs
+    PHASE_NACK          // receiver, waiting for its slot
+};
+
+// sender: chunks pending this round, receiver: chunks stored
+static uint8_t  chunkMap[(CLONE_MAX_CHUNKS + 7) / 8];
+static uint8_t  chunkCount;
+static uint8_t  chunksDone;
+static uint8_t  phase;
+static uint8_t  round;
+static uint8_t  cursor;
+static uint16_t countdown;
+static bool     nackGarbled;
+#endif
 
 static void AIRCOPY_clear()
 {
@@ -56,11 +118,17 @@ static void AIRCOPY_clear()
     #endif
 }
 
+#ifndef ENABLE_AIRCOPY_V2
+bool AIRCOPY_IsReceiving(void)
+{
+    return gAirCopyIsSendMode == 0;
+}
+
 bool AIRCOPY_SendMessage(void)
 {
     static uint8_t gAircopySendCountdown = 1;
 
-    if (gAircopyState != AIRCOPY_TRANSFER) {
+    if (gAircopyState != AIRCOPY_TRANSFER || gAirCopyIsSendMode == 0) {
         return 1;
     }
 
@@ -148,6 +216,335 @@ void AIRCOPY_StorePacket(void)
 
     gAirCopyBlockNumber++;
 }
+#else
+static inline bool TestChunk(uint8_t Chunk)
+{
+    return chunkMap[Chunk / 8] & (1u << (Chunk % 8));
+}
+
+static inline void MarkChunk(uint8_t Chunk)
+{
+    chunkMap[Chunk / 8] |= 1u << (Chunk % 8);
+}
+
+static uint8_t CountChunks(void)
+{
+    uint8_t Count = 0;
+
+    for (uint8_t i = 0; i < chunkCount; i++) {
+        Count += TestChunk(i);
+    }
+
+    return Count;
+}
+
+static void SetProgress(uint8_t Done)
+{
+    chunksDone = Done;
+    gAirCopyBlockNumber = chunkCount ? Done * GAUGE_BLOCKS / chunkCount : 0;
+}
+
+// receivers learn the stream length from whichever frame arrives first
+static bool LearnChunkCount(uint8_t Count)
+{
+    if (Count == 0 || Count > CLONE_MAX_CHUNKS || (chunkCount && Count != chunkCount)) {
+        return false;
+    }
+
+    chunkCount = Count;
+    return true;
+}
+
+static void SendFrame(uint8_t Type, uint8_t Index)
+{
+    g_FSK_Buffer[0] = 0xABCD;
+    g_FSK_Buffer[1] = (Type << 12) | ((round & 0xF) << 8) | Index;
+    g_FSK_Buffer[2 + PAYLOAD_WORDS] = CRC_Calculate(&g_FSK_Buffer[1], 2 + CHUNK_SIZE);
+    g_FSK_Buffer[3 + PAYLOAD_WORDS] = 0xDCBA;
+
+    for (unsigned int i = 0; i < PAYLOAD_WORDS + 2; i++) {
+        g_FSK_Buffer[i + 1] ^= Obfuscation[i % 8];
+    }
+
+    RADIO_SetTxParameters();
+
+    BK4819_SendFSKDataEx(g_FSK_Buffer, AIRCOPY_FRAME_WORDS);
+    BK4819_SetupPowerAmplifier(0, 0);
+    BK4819_ToggleGpioOut(BK4819_GPIO1_PIN29_PA_ENABLE, false);
+}
+
+static void Listen(void)
+{
+    RADIO_SetupRegisters(true);
+    BK4819_SetupAircopy();
+    gFSKWriteIndex = 0;
+    BK4819_PrepareFSKReceive();
+}
+
+static void Complete(void)
+{
+    phase = PHASE_IDLE;
+    gAircopyState = AIRCOPY_COMPLETE;
+    #ifdef ENABLE_SERIAL_SCREENCAST
+        getScreenShot(false);
+    #endif
+}
+
+static void StartRound(void)
+{
+    phase = PHASE_DATA;
+    cursor = 0;
+    countdown = 1;
+    SetProgress(chunkCount - CountChunks());
+}
+
+bool AIRCOPY_IsReceiving(void)
+{
+    return gAirCopyIsSendMode == 0 || phase == PHASE_LISTEN;
+}
+
+bool AIRCOPY_IsBlockDone(uint8_t Block)
+{
+    if (gAirCopyIsSendMode) {
+        return Block < gAirCopyBlockNumber;
+    }
+
+    return chunkCount && TestChunk(Block * chunkCount / GAUGE_BLOCKS);
+}
+
+static bool SendNack(void)
+{
+    uint8_t *pMissing = (uint8_t *)&g_FSK_Buffer[2];
+
+    memset(pMissing, 0, CHUNK_SIZE);
+    for (uint8_t i = 0; i < chunkCount; i++) {
+        if (!TestChunk(i)) {
+            pMissing[i / 8] |= 1u << (i % 8);
+        }
+    }
+
+    SendFrame(FRAME_NACK, chunkCount - CountChunks());
+    Listen();
+    phase = PHASE_IDLE;
+
+    return 0;
+}
+
+bool AIRCOPY_SendMessage(void)
+{
+    if (gAircopyState != AIRCOPY_TRANSFER) {
+        return 1;
+    }
+
+    if (countdown && --countdown) {
+        return 1;
+    }
+
+    if (gAirCopyIsSendMode == 0) {
+        return phase == PHASE_NACK ? SendNack() : 1;
+    }
+
+    switch (phase) {
+    case PHASE_MANIFEST: {
+        uint8_t Chunk[CHUNK_SIZE];
+
+        // page in the high byte, CRCs leave out the count byte so receivers
+        // with a different channel count still match the unchanged chunks
+        memset(&g_FSK_Buffer[2], 0, CHUNK_SIZE);
+        g_FSK_Buffer[2] = (cursor << 8) | chunkCount;
+        for (uint8_t i = 0; i < MANIFEST_CRCS && cursor * MANIFEST_CRCS + i < chunkCount; i++) {
+            CLONE_ReadChunk(cursor * MANIFEST_CRCS + i, Chunk);
+            g_FSK_Buffer[3 + i] = CRC_Calculate(Chunk + 1, CHUNK_SIZE - 1);
+        }
+
+        SendFrame(FRAME_MANIFEST, cursor);
+        countdown = FRAME_GAP_10ms;
+        if (++cursor * MANIFEST_CRCS >= chunkCount) {
+            phase = PHASE_END;
+            cursor = 0;
+        }
+        return 0;
+    }
+
+    case PHASE_DATA:
+        while (cursor < chunkCount && !TestChunk(cursor)) {
+            cursor++;
+        }
+
+        if (cursor < chunkCount) {
+            CLONE_ReadChunk(cursor, (uint8_t *)&g_FSK_Buffer[2]);
+            SendFrame(FRAME_DATA, cursor);
+            SetProgress(chunksDone + 1);
+            cursor++;
+            countdown = FRAME_GAP_10ms;
+            return 0;
+        }
+
+        phase = PHASE_END;
+        cursor = 0;
+        // fall through
+
+    case PHASE_END:
+        memset(&g_FSK_Buffer[2], 0, CHUNK_SIZE);
+        g_FSK_Buffer[2] = chunkCount;
+        SendFrame(FRAME_END, END_REPEAT - 1 - cursor);
+
+        if (++cursor < END_REPEAT) {
+            countdown = FRAME_GAP_10ms;
+            return 0;
+        }
+
+        memset(chunkMap, 0, sizeof(chunkMap));
+        nackGarbled = false;
+        phase = PHASE_LISTEN;
+        countdown = NACK_WINDOW_10ms;
+        Listen();
+        return 0;
+
+    case PHASE_LISTEN:
+        // window closed
+        if (!nackGarbled && CountChunks() == 0) {
+            Complete();
+            return 0;
+        }
+
+        if (++round >= MAX_ROUNDS) {
+            Complete();
+            return 0;
+        }
+
+        if (nackGarbled) {
+            // NACKs collided, nobody can tell what is missing
+            memset(chunkMap, 0xFF, sizeof(chunkMap));
+        }
+
+        StartRound();
+        return 1;
+
+    default:
+        return 1;
+    }
+}
+
+static bool StoreChunk(uint8_t Chunk)
+{
+    if (!CLONE_WriteChunk((const uint8_t *)&g_FSK_Buffer[2])) {
+        return false;
+    }
+
+    MarkChunk(Chunk);
+    return true;
+}
+
+// our own chunks are laid out from our channel list, they match the sender's
+// as long as the channels up to them are used alike
+static void MatchManifest(uint8_t Page)
+{
+    uint16_t Manifest[MANIFEST_CRCS];
+    uint8_t  Chunk[CHUNK_SIZE];
+
+    memcpy(Manifest, &g_FSK_Buffer[3], sizeof(Manifest));
+
+    for (uint8_t i = 0; i < MANIFEST_CRCS; i++) {
+        const uint16_t n = Page * MANIFEST_CRCS + i;
+
+        if (n >= chunkCount) {
+            break;
+        }
+
+        if (TestChunk(n)) {
+            continue;
+        }
+
+        if (CLONE_ReadChunk(n, Chunk) && CRC_Calculate(Chunk + 1, CHUNK_SIZE - 1) == Manifest[i]) {
+            MarkChunk(n);
+        }
+    }
+}
+
+void AIRCOPY_StorePacket(void)
+{
+    if (gFSKWriteIndex < AIRCOPY_FRAME_WORDS) {
+        return;
+    }
+
+    gFSKWriteIndex = 0;
+    gUpdateDisplay = true;
+    uint16_t Status = BK4819_ReadRegister(BK4819_REG_0B);
+    BK4819_PrepareFSKReceive();
+
+    bool Valid = (Status & 0x0010U) == 0 && g_FSK_Buffer[0] == 0xABCD && g_FSK_Buffer[3 + PAYLOAD_WORDS] == 0xDCBA;
+
+    if (Valid) {
+        for (unsigned int i = 0; i < PAYLOAD_WORDS + 2; i++) {
+            g_FSK_Buffer[i + 1] ^= Obfuscation[i % 8];
+        }
+
+        Valid = g_FSK_Buffer[2 + PAYLOAD_WORDS] == CRC_Calculate(&g_FSK_Buffer[1], 2 + CHUNK_SIZE);
+    }
+
+    if (gAirCopyIsSendMode) {
+        if (!Valid) {
+            nackGarbled = true;
+        } else if ((g_FSK_Buffer[1] >> 12) == FRAME_NACK) {
+            const uint8_t *pMissing = (const uint8_t *)&g_FSK_Buffer[2];
+            for (unsigned int i = 0; i < sizeof(chunkMap); i++) {
+                chunkMap[i] |= pMissing[i];
+            }
+        }
+        return;
+    }
+
+    if (!Valid) {
+        gErrorsDuringAirCopy++;
+        return;
+    }
+
+    const uint8_t Type  = g_FSK_Buffer[1] >> 12;
+    const uint8_t Index = g_FSK_Buffer[1] & 0xFF;
+
+    if (Type != FRAME_NACK && !LearnChunkCount(g_FSK_Buffer[2] & 0xFF)) {
+        gErrorsDuringAirCopy++;
+        return;
+    }
+
+    switch (Type) {
+    case FRAME_DATA:
+        if (Index >= chunkCount) {
+            gErrorsDuringAirCopy++;
+            return;
+        }
+        phase = PHASE_IDLE;
+        if (!TestChunk(Index) && !StoreChunk(Index)) {
+            gErrorsDuringAirCopy++;
+            return;
+        }
+        break;
+
+    case FRAME_MANIFEST:
+        MatchManifest(Index);
+        break;
+
+    case FRAME_END:
+        if (phase == PHASE_NACK) {
+            return;
+        }
+        // answer after the last END, in a slot picked from the noise floor
+        phase = PHASE_NACK;
+        countdown = 1 + (Index + (BK4819_GetRSSI() ^ gErrorsDuringAirCopy) % NACK_SLOTS) * NACK_SLOT_10ms;
+        return;
+
+    default:
+        return;
+    }
+
+    SetProgress(CountChunks());
+
+    if (chunksDone == chunkCount) {
+        Complete();
+    }
+}
+#endif
 
 static void AIRCOPY_Key_DIGITS(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
 {
@@ -210,6 +607,13 @@ static void AIRCOPY_Key_EXIT(bool bKeyPressed, bool bKeyHeld)
         gInputBoxIndex = 0;
         gErrorsDuringAirCopy = lErrorsDuringAirCopy = 0;
         gAirCopyIsSendMode = 0;
+#ifdef ENABLE_AIRCOPY_V2
+        memset(chunkMap, 0, sizeof(chunkMap));
+        chunkCount = 0;
+        chunksDone = 0;
+        phase = PHASE_IDLE;
+        countdown = 0;
+#endif
 
         AIRCOPY_clear();
 
@@ -223,7 +627,7 @@ static void AIRCOPY_Key_EXIT(bool bKeyPressed, bool bKeyHeld)
     gRequestDisplayScreen = DISPLAY_AIRCOPY;
 }
 
-static void AIRCOPY_Key_MENU(bool bKeyPressed, bool bKeyHeld)
+static void AIRCOPY_Key_MENU(bool bKeyPressed, bool bKeyHeld, bool bDelta)
 {
     if (bKeyHeld || !bKeyPressed) {
         return;
@@ -234,9 +638,20 @@ static void AIRCOPY_Key_MENU(bool bKeyPressed, bool bKeyHeld)
     gAirCopyBlockNumber = 0;
     gInputBoxIndex = 0;
     gAirCopyIsSendMode = 1;
+#ifdef ENABLE_AIRCOPY_V2
+    round = 0;
+    chunkCount = CLONE_GetChunkCount();
+    memset(chunkMap, bDelta ? 0x00 : 0xFF, sizeof(chunkMap));
+    StartRound();
+    if (bDelta) {
+        phase = PHASE_MANIFEST;
+    }
+#else
+    (void)bDelta;
     g_FSK_Buffer[0] = 0xABCD;
     g_FSK_Buffer[1] = 0;
     g_FSK_Buffer[35] = 0xDCBA;
+#endif
 
     AIRCOPY_clear();
 
@@ -261,8 +676,13 @@ void AIRCOPY_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
         AIRCOPY_Key_DIGITS(Key, bKeyPressed, bKeyHeld);
         break;
     case KEY_MENU:
-        AIRCOPY_Key_MENU(bKeyPressed, bKeyHeld);
+        AIRCOPY_Key_MENU(bKeyPressed, bKeyHeld, false);
         break;
+#ifdef ENABLE_AIRCOPY_V2
+    case KEY_STAR:
+        AIRCOPY_Key_MENU(bKeyPressed, bKeyHeld, true);
+        break;
+#endif
     case KEY_EXIT:
         AIRCOPY_Key_EXIT(bKeyPressed, bKeyHeld);
         break;
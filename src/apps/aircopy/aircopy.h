@@ -30,15 +30,25 @@ enum AIRCOPY_State_t
 
 typedef enum AIRCOPY_State_t AIRCOPY_State_t;
 
+#ifdef ENABLE_AIRCOPY_V2
+    #define AIRCOPY_FRAME_WORDS 68
+#else
+    #define AIRCOPY_FRAME_WORDS 36
+#endif
+
 extern AIRCOPY_State_t gAircopyState;
 extern uint16_t        gAirCopyBlockNumber;
 extern uint16_t        gErrorsDuringAirCopy;
 extern uint8_t         gAirCopyIsSendMode;
 
-extern uint16_t        g_FSK_Buffer[36];
+extern uint16_t        g_FSK_Buffer[AIRCOPY_FRAME_WORDS];
 
 bool AIRCOPY_SendMessage(void);
 void AIRCOPY_StorePacket(void);
+bool AIRCOPY_IsReceiving(void);
+#ifdef ENABLE_AIRCOPY_V2
+    bool AIRCOPY_IsBlockDone(uint8_t Block);
+#endif
 void AIRCOPY_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld);
 
 #endif
@@ -26,6 +26,7 @@
 #include "ui/helper.h"
 #include "ui/inputbox.h"
 
+#ifndef ENABLE_AIRCOPY_V2
 static void set_bit(uint8_t* array, int bit_index) {
     array[bit_index / 8] |= (1 << (bit_index % 8));
 }
@@ -33,6 +34,7 @@ static void set_bit(uint8_t* array, int bit_index) {
 static int get_bit(uint8_t* array, int bit_index) {
     return (array[bit_index / 8] >> (bit_index % 8)) & 1;
 }
+#endif
 
 void UI_DisplayAircopy(void)
 {
@@ -103,6 +105,19 @@ void UI_DisplayAircopy(void)
         gFrameBuffer[4][126] = 0x3c;
     }
 
+#ifdef ENABLE_AIRCOPY_V2
+    // blocks arrive out of order across repeat rounds, draw what is in
+    if(gAircopyStep != 0)
+    {
+        for(uint8_t i = 0; i < 120; i++)
+        {
+            if(AIRCOPY_IsBlockDone(i))
+            {
+                gFrameBuffer[4][i + 4] = 0xbd;
+            }
+        }
+    }
+#else
     if(gAirCopyBlockNumber + gErrorsDuringAirCopy != 0)
     {
         // Check CRC
@@ -120,6 +135,7 @@ void UI_DisplayAircopy(void)
             }
         }
     }
+#endif
 
     ST7565_BlitFullScreen();
 }
@@ -25,6 +25,12 @@
 #include "apps/battery/battery_ui.h"
 #include "ui/menu.h"
 #include "ui/ui.h"
+#ifdef ENABLE_BATTERY_MODEL
+    #include "features/radio/radio.h"
+    #ifdef ENABLE_FMRADIO
+        #include "apps/fm/fm.h"
+    #endif
+#endif
 //#include "core/debugging.h"
 
 uint16_t          gBatteryCalibration[6];
@@ -128,6 +134,144 @@ unsigned int BATTERY_VoltsToPercent(const unsigned int voltage_10mV)
     return 0;
 }
 
+#ifdef ENABLE_BATTERY_MODEL
+// Coulomb counter: the charge left is integrated from the estimated draw of
+// the current radio state and slowly pulled towards the voltage curve while
+// the battery is at rest, so TX sag never shows up in the percentage.
+
+#define REST_TICKS      60      // 30 s without TX or charger before the voltage is trusted
+#define REST_GAIN       512     // ~4 min time constant towards the voltage curve
+#define CHARGE_GAIN     16      // the charger has no model, follow the voltage
+#define LOAD_AVG_TICKS  1200    // ~10 min mean of the draw
+
+static const uint16_t BatteryCapacity_mAh[] = {
+    [BATTERY_TYPE_1600_MAH] = 1600,
+    [BATTERY_TYPE_2200_MAH] = 2200,
+    [BATTERY_TYPE_3500_MAH] = 3500,
+    [BATTERY_TYPE_1500_MAH] = 1500,
+    [BATTERY_TYPE_2500_MAH] = 2500,
+};
+
+// Typical draw at 7.4 V, indexed by OUTPUT_POWER
+static const uint16_t TxLoad_mA[] = {1100, 450, 500, 560, 640, 760, 1100, 1600};
+// Backlight LED draw per brightness step, follows the PWM curve
+static const uint8_t  BacklightLoad_mA[] = {0, 1, 1, 2, 3, 4, 6, 10, 16, 25, 40};
+
+static int32_t  charge_mAs = -1;    // -1 until seeded from the voltage
+static int32_t  loadAvg;            // mA, Q12
+static uint16_t restTicks;
+
+static int32_t GetCapacity_mAs(void)
+{
+    const uint8_t type = gEeprom.BATTERY_TYPE < ARRAY_SIZE(BatteryCapacity_mAh) ? gEeprom.BATTERY_TYPE : BATTERY_TYPE_1600_MAH;
+    return (int32_t)BatteryCapacity_mAh[type] * 3600;
+}
+
+static uint16_t EstimateLoad_mA(void)
+{
+    uint16_t load;
+
+    switch (gCurrentFunction) {
+        case FUNCTION_TRANSMIT:
+            load = TxLoad_mA[gCurrentVfo->OUTPUT_POWER < ARRAY_SIZE(TxLoad_mA) ? gCurrentVfo->OUTPUT_POWER : OUTPUT_POWER_HIGH];
+            break;
+        case FUNCTION_MONITOR:
+        case FUNCTION_INCOMING:
+            load = 140;     // audio amplifier on
+            break;
+        case FUNCTION_POWER_SAVE:
+            load = 20;
+            break;
+        default:
+            load = 55;
+            break;
+    }
+
+#ifdef ENABLE_FMRADIO
+    if (gFmRadioMode && gCurrentFunction != FUNCTION_TRANSMIT)
+        load += 60;
+#endif
+
+    if (BACKLIGHT_IsOn()) {
+        const uint8_t level = BACKLIGHT_GetBrightness();
+        load += BacklightLoad_mA[level < ARRAY_SIZE(BacklightLoad_mA) ? level : ARRAY_SIZE(BacklightLoad_mA) - 1];
+    }
+
+    return load;
+}
+
+static void ModelTimeSlice500ms(void)
+{
+    const uint16_t load = EstimateLoad_mA();
+
+    if (gCurrentFunction == FUNCTION_TRANSMIT || gIsCharging)
+        restTicks = 0;
+    else if (restTicks < REST_TICKS)
+        restTicks++;
+
+    if (loadAvg == 0)
+        loadAvg = (int32_t)load << 12;
+    loadAvg += (((int32_t)load << 12) - loadAvg) / LOAD_AVG_TICKS;
+
+    if (charge_mAs < 0 || gIsCharging)
+        return;
+
+    charge_mAs -= load / 2;
+    if (charge_mAs < 0)
+        charge_mAs = 0;
+}
+
+// Called with a fresh gBatteryVoltageAverage, never during TX
+static void ModelFuseVoltage(void)
+{
+    const int32_t capacity = GetCapacity_mAs();
+    const int32_t target   = capacity / 100 * (int32_t)BATTERY_VoltsToPercent(gBatteryVoltageAverage);
+
+    if (charge_mAs < 0)
+        charge_mAs = target;
+    else if (gIsCharging)
+        charge_mAs += (target - charge_mAs) / CHARGE_GAIN;
+    else if (restTicks >= REST_TICKS)
+        charge_mAs += (target - charge_mAs) / REST_GAIN;
+
+    if (charge_mAs > capacity)
+        charge_mAs = capacity;
+}
+
+void BATTERY_CatchUp(uint16_t Slices)
+{
+    while (Slices--)
+        ModelTimeSlice500ms();
+}
+
+uint16_t BATTERY_GetLoad_mA(void)
+{
+    return (loadAvg + (1 << 11)) >> 12;
+}
+
+uint16_t BATTERY_GetRuntimeMinutes(void)
+{
+    const uint16_t load = BATTERY_GetLoad_mA();
+
+    if (charge_mAs <= 0 || load == 0)
+        return 0;
+
+    const uint32_t minutes = (uint32_t)charge_mAs / load / 60;
+    return MIN(minutes, BATTERY_RUNTIME_MAX_MIN);
+}
+#endif
+
+unsigned int BATTERY_GetPercent(void)
+{
+#ifdef ENABLE_BATTERY_MODEL
+    if (charge_mAs >= 0) {
+        const int32_t capacity = GetCapacity_mAs();
+        return (charge_mAs * 100 + capacity / 2) / capacity;
+    }
+#endif
+    return BATTERY_VoltsToPercent(gBatteryVoltageAverage);
+}
+
 void BATTERY_GetReadings(const bool bDisplayBatteryLevel)
 {
 #ifdef ENABLE_BATTERY_CHARGING
@@ -181,6 +325,10 @@ void BATTERY_GetReadings(const bool bDisplayBatteryLevel)
     gBatteryVoltageAverage = (gBatteryVoltageAverage * 3 + NewVoltage) / 4;
 #endif
 
+#ifdef ENABLE_BATTERY_MODEL
+    ModelFuseVoltage();
+#endif
+
     // Update display level based on smoothed average
     if(gBatteryVoltageAverage > 890)
         gBatteryDisplayLevel = 7; // battery overvoltage
@@ -191,7 +339,7 @@ void BATTERY_GetReadings(const bool bDisplayBatteryLevel)
     else {
         gBatteryDisplayLevel = 1;
         const uint8_t levels[] = {5,17,41,65,88};
-        uint8_t perc = BATTERY_VoltsToPercent(gBatteryVoltageAverage);
+        uint8_t perc = BATTERY_GetPercent();
 
         for(uint8_t i = 6; i >= 2; i--){
             if (perc > levels[i-2]) {
@@ -276,6 +424,10 @@ void BATTERY_GetReadings(const bool bDisplayBatteryLevel)
 
 void BATTERY_TimeSlice500ms(void)
 {
+#ifdef ENABLE_BATTERY_MODEL
+    ModelTimeSlice500ms();
+#endif
+
     if (!gLowBattery) {
         return;
     }
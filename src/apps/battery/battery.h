@@ -44,7 +44,19 @@ typedef enum {
 
 
 unsigned int BATTERY_VoltsToPercent(unsigned int voltage_10mV);
+unsigned int BATTERY_GetPercent(void);
 void BATTERY_GetReadings(bool bDisplayBatteryLevel);
 void BATTERY_TimeSlice500ms(void);
 
+#ifdef ENABLE_BATTERY_MODEL
+#define BATTERY_RUNTIME_MAX_MIN  (99 * 60 + 59)
+
+// Estimated draw from the battery, averaged over the last ~10 minutes
+uint16_t BATTERY_GetLoad_mA(void);
+// Time left at that average draw, capped at BATTERY_RUNTIME_MAX_MIN
+uint16_t BATTERY_GetRuntimeMinutes(void);
+// Accounts for 500 ms slices that went by without BATTERY_TimeSlice500ms()
+void BATTERY_CatchUp(uint16_t Slices);
+#endif
+
 #endif
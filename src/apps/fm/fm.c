@@ -38,6 +38,11 @@
 #endif
 
 #define FM_CHANNELS_MAX 20
+#define FM_VOLUME       11
+
+#ifdef ENABLE_FM_DUAL_RX
+    #define FM_DUCK_VOLUME  3
+#endif
 
 uint16_t          gFM_Channels[FM_CHANNELS_MAX];
 bool              gFmRadioMode;
@@ -63,6 +68,29 @@ bool              gFmFunctionMode = false;
 
 static uint8_t s_fm_update_tick = 0;
 
+#ifdef ENABLE_FM_SEEK_SCAN
+// Autoscan lets the BK1080 seek engine find the stations and only visits
+// those, a full 64-108 MHz pass takes a few seconds instead of stepping
+// every channel. The best FM_CHANNELS_MAX stations are kept ranked in RAM
+// and written to the FM memories in one go when the scan ends.
+
+#define SEEK_POLL_10ms      2
+#define SEEK_TIMEOUT_POLLS  500     // 10 s, the chip gave up
+
+typedef struct {
+    uint16_t Frequency;
+    uint8_t  Rssi;
+    uint8_t  Snr    : 4;
+    uint8_t  Stereo : 1;
+} FM_Station_t;
+
+static FM_Station_t s_stations[FM_CHANNELS_MAX];
+static uint8_t      s_station_count;
+static bool         s_seek_tuning;
+static uint16_t     s_seek_from;
+static uint16_t     s_seek_polls;
+#endif
+
 const uint8_t BUTTON_STATE_PRESSED = 1 << 0;
 const uint8_t BUTTON_STATE_HELD = 1 << 1;
 
@@ -167,10 +195,141 @@ void FM_Tune(uint16_t Frequency, int8_t Step, bool bFlag)
     BK1080_SetFrequency(gEeprom.FM_FrequencyPlaying, gEeprom.FM_Band, gFmSpacing);
 }
 
+#ifdef ENABLE_FM_SEEK_SCAN
+static uint16_t StationQuality(const FM_Station_t *pStation)
+{
+    return pStation->Rssi + 2 * pStation->Snr + (pStation->Stereo ? 8 : 0);
+}
+
+static void AddStation(uint16_t Frequency)
+{
+    const uint16_t s = (gFmSpacing == 0) ? 20 : (gFmSpacing == 1) ? 10 : 5;
+    FM_Station_t   station = {
+        .Frequency = Frequency,
+        .Rssi      = BK1080_GetRSSI(),
+        .Snr       = BK1080_GetSNR(),
+        .Stereo    = BK1080_IsStereo(),
+    };
+    const uint16_t quality = StationQuality(&station);
+    uint8_t        i;
+
+    // a strong station can stop the seek on its neighbour channel as well
+    for (i = 0; i < s_station_count; i++) {
+        const int16_t d = Frequency - s_stations[i].Frequency;
+        if (d <= s && d >= -s) {
+            if (StationQuality(&s_stations[i]) >= quality)
+                return;
+            s_station_count--;
+            memmove(&s_stations[i], &s_stations[i + 1], (s_station_count - i) * sizeof(s_stations[0]));
+            break;
+        }
+    }
+
+    // insert ranked, the weakest drops off a full table
+    for (i = s_station_count; i > 0 && StationQuality(&s_stations[i - 1]) < quality; i--) {
+        if (i < FM_CHANNELS_MAX)
+            s_stations[i] = s_stations[i - 1];
+    }
+    if (i >= FM_CHANNELS_MAX)
+        return;
+
+    s_stations[i] = station;
+    if (s_station_count < FM_CHANNELS_MAX)
+        s_station_count++;
+}
+
+static void SeekFrom(uint16_t Frequency)
+{
+    BK1080_SetFrequency(Frequency, gEeprom.FM_Band, gFmSpacing);
+    gEeprom.FM_FrequencyPlaying = Frequency;
+    s_seek_from           = Frequency;
+    s_seek_tuning         = true;
+    s_seek_polls          = 0;
+    gFmPlayCountdown_10ms = SEEK_POLL_10ms;
+}
+
+void FM_AutoScanStart(void)
+{
+    AUDIO_AudioPathOff();
+    gEnableSpeaker = false;
+
+    gScheduleFM         = false;
+    gFM_FoundFrequency  = false;
+    gAskToSave          = false;
+    gAskToDelete        = false;
+    gFM_AutoScan        = true;
+    gFM_ScanState       = 1;
+    gFM_ChannelPosition = 0;
+    s_station_count     = 0;
+
+    // BK1080_SetFrequency() picks the chip band from the frequency, the
+    // pass covers both of them whatever FM_Band says
+    SeekFrom(6400);
+}
+
+static void SeekScanPoll(void)
+{
+    uint16_t Frequency = 0;
+
+    if (s_seek_tuning) {
+        s_seek_tuning = false;
+        BK1080_StartSeek();
+        gFmPlayCountdown_10ms = SEEK_POLL_10ms;
+        return;
+    }
+
+    BK1080_SeekResult_t result = BK1080_PollSeek(&Frequency);
+    if (result == BK1080_SEEK_BUSY) {
+        if (++s_seek_polls < SEEK_TIMEOUT_POLLS) {
+            gFmPlayCountdown_10ms = SEEK_POLL_10ms;
+            return;
+        }
+        BK1080_StopSeek();
+        result = BK1080_SEEK_BAND_END;
+    }
+
+    if (result == BK1080_SEEK_FOUND) {
+        AddStation(Frequency);
+        gFM_ChannelPosition = s_station_count;
+        // a station on 108 MHz ends the pass, there is nothing above it
+        if (Frequency < 10800) {
+            SeekFrom(Frequency);
+            return;
+        }
+    }
+
+    // the BK1080 bands split at 76 MHz, go on in the upper one
+    if (s_seek_from < 7600) {
+        SeekFrom(7600);
+        return;
+    }
+
+    FM_PlayAndUpdate();
+}
+
+// Ranked stations to the FM memories, best first
+static void SeekScanCommit(void)
+{
+    BK1080_StopSeek();
+
+    if (s_station_count == 0)
+        return;
+
+    memset(gFM_Channels, 0xFF, sizeof(gFM_Channels));
+    for (uint8_t i = 0; i < s_station_count; i++)
+        gFM_Channels[i] = s_stations[i].Frequency;
+}
+#endif
+
 void FM_PlayAndUpdate(void)
 {
     gFM_ScanState = FM_SCAN_OFF;
 
+#ifdef ENABLE_FM_SEEK_SCAN
+    if (gFM_AutoScan)
+        SeekScanCommit();
+#endif
+
     if (gFM_AutoScan) {
         gEeprom.FM_IsMrMode        = true;
         gEeprom.FM_SelectedChannel = 0;
@@ -393,6 +552,12 @@ static void Key_FUNC(KEY_Code_t Key, uint8_t state)
                     FM_PlayAndUpdate();
                 } else {
                     gFM_AutoScan = (fMode || state == BUTTON_EVENT_HELD);
+#ifdef ENABLE_FM_SEEK_SCAN
+                    if (gFM_AutoScan) {
+                        FM_AutoScanStart();
+                        break;
+                    }
+#endif
                     FM_Tune(gEeprom.FM_FrequencyPlaying, 1, false);
                 }
                 break;
@@ -537,6 +702,14 @@ void FM_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
 
 void FM_Play(void)
 {
+#ifdef ENABLE_FM_SEEK_SCAN
+    if (gFM_AutoScan) {
+        SeekScanPoll();
+        GUI_SelectNextDisplay(DISPLAY_FM);
+        return;
+    }
+#endif
+
     if (FM_CheckFrequencyLock(gEeprom.FM_FrequencyPlaying, 6400) == 0) {
         if (!gFM_AutoScan) {
             gFmPlayCountdown_10ms = 0;
@@ -556,6 +729,23 @@ void FM_Play(void)
     GUI_SelectNextDisplay(DISPLAY_FM);
 }
 
+#ifdef ENABLE_FM_DUAL_RX
+bool FM_IsPlaying(void)
+{
+    return gFmRadioMode && gFM_ScanState == FM_SCAN_OFF;
+}
+
+// The BK1080 stays powered while the BK4819 receives, only its volume drops
+void FM_Duck(bool bDuck)
+{
+    if (gFM_AutoMuted == bDuck) return;
+    gFM_AutoMuted = bDuck;
+    BK1080_SetVolume(bDuck ? FM_DUCK_VOLUME : FM_VOLUME);
+    gRequestDisplayScreen = bDuck ? DISPLAY_MAIN : DISPLAY_FM;
+    gUpdateDisplay = true;
+}
+#endif
+
 void FM_CheckAutoMute(void)
 {
     if (!gFmRadioMode) return;
@@ -564,6 +754,17 @@ void FM_CheckAutoMute(void)
     }
     if (gFM_ScanState != FM_SCAN_OFF) return;
 
+#ifdef ENABLE_FM_DUAL_RX
+    // runs right after the BK4819 interrupts, so a call ducks within the tick
+    if (g_SquelchLost || FUNCTION_IsRx()) {
+        FM_Duck(true);
+        gFmAutoMuteCountdown_10ms = 200;
+    } else if (gFM_AutoMuted && gFmAutoMuteCountdown_10ms == 0) {
+        FM_Duck(false);
+    }
+    return;
+#endif
+
     if (g_SquelchLost) {
         if (!gFM_AutoMuted) { BK1080_Mute(true); AUDIO_AudioPathOff(); gFM_AutoMuted = true; gRequestDisplayScreen = DISPLAY_MAIN; }
         gFmAutoMuteCountdown_10ms = 200;
@@ -589,7 +790,7 @@ void FM_Start(void)
     BK1080_SetSoftMute(gFmSoftMuteRate, gFmSoftMuteAttenuation);
     BK1080_SetSeekThresholds(gFmSeekRSSIThreshold, gFmSeekSNRThreshold);
     BK1080_SetFrequency(gEeprom.FM_FrequencyPlaying, gEeprom.FM_Band, gFmSpacing);
-    BK1080_SetVolume(11);
+    BK1080_SetVolume(FM_VOLUME);
 
     AUDIO_AudioPathOn();
     gEnableSpeaker       = true;
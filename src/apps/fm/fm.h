@@ -55,6 +55,9 @@ void    FM_TurnOff(void);
 void    FM_EraseChannels(void);
 
 void    FM_Tune(uint16_t Frequency, int8_t Step, bool bFlag);
+#ifdef ENABLE_FM_SEEK_SCAN
+void    FM_AutoScanStart(void);
+#endif
 void    FM_PlayAndUpdate(void);
 int     FM_CheckFrequencyLock(uint16_t Frequency, uint16_t LowerLimit);
 
@@ -64,6 +67,12 @@ void    FM_Play(void);
 void    FM_CheckAutoMute(void);
 void    FM_Start(void);
 
+#ifdef ENABLE_FM_DUAL_RX
+// BK1080 playing and not scanning, the BK4819 may share the speaker
+bool    FM_IsPlaying(void);
+void    FM_Duck(bool bDuck);
+#endif
+
 #endif
 
 #endif
@@ -140,7 +140,7 @@ void UI_DisplayLauncher(void) {
     // allow logic to persist.
 
     AG_MENU_Render();
-    ST7565_BlitFullScreen();
+    AG_MENU_Blit();
 }
 
 
@@ -34,11 +34,9 @@ static uint8_t  s_CommValue1 = 0;
 
 static uint16_t CEC_GetRssi(void)
 {
-    int wait_count = 0;
-    while (((BK4819_ReadRegister(0x63) & 0xFF) >= 255) && wait_count++ < 100)
-        SYSTICK_DelayUs(100);
+    const uint16_t settle = BK4819_GetRssiSettleUs(gTxVfo->StepFrequency, (BK4819_FilterBandwidth_t)gTxVfo->CHANNEL_BANDWIDTH);
 
-    return BK4819_GetRSSI();
+    return BK4819_AcquireRSSI(settle, 2);
 }
 
 void LiveSeek_Init(void)
@@ -946,8 +946,10 @@ void MEMORIES_Render(void) {
             break;
         default:
             AG_MENU_Render();
-            break;
+            AG_MENU_Blit();
+            return;
     }
+    AG_MENU_Invalidate();
     ST7565_BlitFullScreen();
 }
 
@@ -453,11 +453,19 @@ void SCANNER_TimeSlice10ms(void)
                 const uint8_t Code = DCS_GetCdcssCode(cdcssFreq);
                 if (Code != 0xFF)
                 {
-                    gScanCssResultCode = Code;
+                    // noise decodes now and then, take a code once it repeats
+                    if (Code == gScanCssResultCode && gScanCssResultType == CODE_TYPE_DIGITAL) {
+                        if (++scanHitCount >= 2) {
+                            gScanCssState     = SCAN_CSS_STATE_FOUND;
+                            gScanUseCssResult = true;
+                            gUpdateStatus     = true;
+                        }
+                    }
+                    else
+                        scanHitCount = 0;
+
                     gScanCssResultType = CODE_TYPE_DIGITAL;
-                    gScanCssState      = SCAN_CSS_STATE_FOUND;
-                    gScanUseCssResult  = true;
-                    gUpdateStatus      = true;
+                    gScanCssResultCode = Code;
                 }
             }
             else if (scanResult == BK4819_CSS_RESULT_CTCSS) {
@@ -1,5 +1,6 @@
 #ifdef ENABLE_PASSCODE
 #include <string.h>
+#include <stddef.h>
 #include "passcode.h"
 #include "features/storage/storage.h"
 #include "helper/crypto.h"
@@ -22,6 +23,12 @@
 #define PASSCODE_MAGIC 0x51534850 // "QSHP" (Bumped for safe MigratedMask init)
 #define PASSCODE_MAX_LEN 32
 #define KDF_ITERATIONS 8192
+// Passcode_Set benchmarks the stretcher and picks the iteration count that
+// makes one unlock (verifier + KEK) take about KDF_TARGET_MS
+#define KDF_TARGET_MS 1000
+#define KDF_MIN_ITERATIONS KDF_ITERATIONS
+#define KDF_MAX_ITERATIONS (1UL << 20)
+#define KDF_BENCH_ROUNDS 64
 #define DEFAULT_MAX_TRIES 10
 
 static PasscodeConfig_t gPasscodeConfig;
@@ -30,10 +37,13 @@ static bool gPasscodeLocked = true; // Default to locked until validated
 
 // --- Backend ---
 
+static void RecoverConfig(void);
+
 static void LoadConfig(void) {
     if (!gPasscodeLoaded) {
         Storage_ReadRecord(REC_PASSCODE, &gPasscodeConfig, 0, sizeof(PasscodeConfig_t));
         gPasscodeLoaded = true;
+        if (gPasscodeConfig.fields.Magic != PASSCODE_MAGIC) RecoverConfig();
         
         // Sanitize
         if (gPasscodeConfig.fields.Length > PASSCODE_MAX_LEN) gPasscodeConfig.fields.Length = PASSCODE_MAX_LEN;
@@ -45,6 +55,15 @@ void Passcode_SaveConfig(void) {
     Storage_WriteRecord(REC_PASSCODE, &gPasscodeConfig, 0, sizeof(PasscodeConfig_t));
 }
 
+// Lockout counts and the migration journal must be on the flash before we
+// go on: with ASYNC_FLASH a save is only queued until the main loop polls,
+// and the passcode prompt runs before it.
+static void FlushConfig(void) {
+#ifdef ENABLE_ASYNC_FLASH
+    PY25Q16_Flush();
+#endif
+}
+
 // Global Master Key in RAM
 static uint8_t gMasterKey[32] = {0};
 
@@ -188,6 +207,40 @@ static void Passcode_Stretcher(chacha20_ctx *ctx, uint32_t iterations, uint8_t *
     memset(state_block, 0, 64);
 }
 
+// Core clock cycles for one stretcher round, timed with SysTick (which runs
+// from the core clock, so the result follows the clock configuration)
+static uint32_t BenchmarkRound(void) {
+    chacha20_ctx ctx;
+    uint8_t key[32] = {0};
+    uint8_t nonce[12] = {0};
+    chacha20_init(&ctx, key, nonce, 0);
+
+    const uint32_t reload = SysTick->LOAD + 1;
+    uint32_t cycles = 0;
+    uint32_t previous = SysTick->VAL;
+    for (int i = 0; i < KDF_BENCH_ROUNDS; i++) {
+        Passcode_Stretcher(&ctx, 1, NULL);
+        // one round is far shorter than a SysTick period, at most one wrap
+        uint32_t current = SysTick->VAL;
+        cycles += (current <= previous) ? previous - current : previous + reload - current;
+        previous = current;
+    }
+    memset(&ctx, 0, sizeof(ctx));
+    return cycles / KDF_BENCH_ROUNDS;
+}
+
+static uint32_t CalibrateIterations(void) {
+    uint32_t perRound = BenchmarkRound();
+    if (perRound == 0) return KDF_ITERATIONS;
+
+    // an unlock runs the stretcher twice: verifier, then KEK
+    uint64_t budget = (uint64_t)SystemCoreClock / 1000 * KDF_TARGET_MS;
+    uint64_t it = budget / (2ULL * perRound);
+    if (it < KDF_MIN_ITERATIONS) it = KDF_MIN_ITERATIONS;
+    if (it > KDF_MAX_ITERATIONS) it = KDF_MAX_ITERATIONS;
+    return (uint32_t)it;
+}
+
 static void ComputeVerifier(const char *input, const uint8_t *nonce, uint8_t *verifier) {
     uint8_t key[32] = {0};
     strncpy((char*)key, input, 32);
@@ -211,8 +264,11 @@ void Passcode_DeriveKEK(const char *password, uint8_t *kek_out) {
     GetCpuId(salt, 12); 
     salt[12] = 0xAA; salt[13] = 0xBB; salt[14] = 0xCC; salt[15] = 0xDD;
     
+    // The empty password KEK also keys ENC_CPUID storage, it must not
+    // follow the calibrated count
     chacha20_ctx ctx;
     uint32_t it = gPasscodeConfig.fields.Iterations > 0 ? gPasscodeConfig.fields.Iterations : KDF_ITERATIONS;
+    if (password[0] == '\0') it = KDF_ITERATIONS;
     chacha20_init(&ctx, key, salt, 0);
     uint8_t block[64];
     for (uint32_t i = 0; i < it; i++) {
@@ -276,27 +332,103 @@ bool Passcode_IsMigrated(RecordID_t id) {
     return (gPasscodeConfig.fields.MigratedMask & (1ULL << id)) != 0;
 }
 
-void Passcode_SetMigrated(RecordID_t id) {
-    gPasscodeConfig.fields.MigratedMask |= (1ULL << id);
+static bool CanMigrate(uint64_t mask) {
+    if (!(Passcode_IsLocked() && Passcode_IsSet())) return true;
+    for (int i = 0; i < REC_MAX; i++) {
+        if ((mask & (1ULL << i)) && Storage_GetEncryptionType((RecordID_t)i) == ENC_PASSCODE) return false;
+    }
+    return true;
+}
+
+#define JOURNAL_PENDING   0xFF
+#define JOURNAL_BACKED_UP 0x5A
+#define JOURNAL_DONE      0x00
+
+static void JournalWrite(uint8_t *pField) {
+    Storage_WriteRecord(REC_PASSCODE, pField, (uint32_t)(pField - gPasscodeConfig.raw), 1);
+}
+
+// This config shares a sector with other records. Power lost while MigrateRun
+// rewrote that sector leaves no config in flash, the scratch copy still has
+// it. It was taken before its own sector was marked, so mark it here and
+// MigrateRun rebuilds the sector from the copy.
+static void RecoverConfig(void) {
+    PasscodeConfig_t backup;
+
+    Storage_ReadBackup(REC_PASSCODE, &backup, sizeof(backup));
+    if (backup.fields.Magic == PASSCODE_MAGIC && backup.fields.JournalMask != 0) {
+        backup.fields.JournalDone[Storage_GetAddress(REC_PASSCODE, 0) / 0x1000] = JOURNAL_BACKED_UP;
+        memcpy(&gPasscodeConfig, &backup, sizeof(backup));
+    }
+    memset(&backup, 0, sizeof(backup));
+}
+
+// One migration run: the journal is written before the first sector. Each
+// sector is copied to the scratch sector, then goes JournalDone 0xFF ->
+// 0x5A -> 0x00, programming only 0xFF bytes, so no erase. Once marked, the
+// sector is always rebuilt from the copy: a run cut short by power loss,
+// even halfway through the erase, resumes with the same mask, skips the
+// finished sectors and redoes the marked one from the original. The
+// scratch sector is wiped at the end so no stale copy outlives the run.
+static bool MigrateRun(uint64_t mask) {
+    if (mask == 0) return true;
+    if (!CanMigrate(mask)) return false;
+
+    if (gPasscodeConfig.fields.JournalMask != mask) {
+        gPasscodeConfig.fields.JournalMask = mask;
+        memset(gPasscodeConfig.fields.JournalDone, JOURNAL_PENDING, sizeof(gPasscodeConfig.fields.JournalDone));
+        Passcode_SaveConfig();
+        FlushConfig();
+    }
+
+    uint16_t sectors = Storage_GetMigrationSectors(mask);
+    for (uint8_t n = 0; n < STORAGE_MIGRATE_SECTORS; n++) {
+        uint8_t *pDone = &gPasscodeConfig.fields.JournalDone[n];
+
+        if (!(sectors & (1U << n)) || *pDone == JOURNAL_DONE) continue;
+
+        if (*pDone == JOURNAL_PENDING) {
+            Storage_BackupSector(n);
+            *pDone = JOURNAL_BACKED_UP;
+            JournalWrite(pDone);
+            FlushConfig();
+        }
+
+        Storage_MigrateSector(n, mask, true);
+
+        *pDone = JOURNAL_DONE;
+        JournalWrite(pDone);
+        FlushConfig();
+        KickWatchdog();
+    }
+
+    Storage_ClearBackup();
+    gPasscodeConfig.fields.MigratedMask |= mask;
+    gPasscodeConfig.fields.JournalMask = 0;
+    Passcode_SaveConfig();
+    FlushConfig();
+    return true;
+}
+
+bool Passcode_MigrateRecords(uint64_t mask) {
+    LoadConfig();
+
+    // An interrupted run has to finish with its own mask first, its sectors
+    // are only partly re-encrypted
+    uint64_t pending = gPasscodeConfig.fields.JournalMask;
+    if (pending != 0 && pending != mask && !MigrateRun(pending)) return false;
+
+    return MigrateRun(mask & ~gPasscodeConfig.fields.MigratedMask);
 }
 
 void Passcode_MigrateStorage(void) {
-    if (Passcode_IsLocked() && Passcode_IsSet()) return;
-    bool changed = false;
+    uint64_t mask = 0;
     for (int i = 0; i < REC_MAX; i++) {
         if (Passcode_IsMigrated((RecordID_t)i)) continue;
-        StorageEnc_t enc = Storage_GetEncryptionType((RecordID_t)i);
-        if (enc == ENC_PLAIN) {
-            Passcode_SetMigrated((RecordID_t)i); 
-            changed = true;
-            continue;
-        }
-        if (enc == ENC_PASSCODE && Passcode_IsLocked() && Passcode_IsSet()) continue;
-        Storage_MigrateRecord((RecordID_t)i);
-        changed = true;
-        KickWatchdog();
+        if (!CanMigrate(1ULL << i)) continue;
+        mask |= 1ULL << i;
     }
-    if (changed) Passcode_SaveConfig();
+    if (mask != 0 || gPasscodeConfig.fields.JournalMask != 0) Passcode_MigrateRecords(mask);
 }
 
 bool Passcode_Validate(const char *input) {
@@ -342,6 +474,7 @@ bool Passcode_Validate(const char *input) {
         
         gPasscodeConfig.fields.Tries++;
         Passcode_SaveConfig();
+        FlushConfig();
         
         // Reboot if limit reached
         if (gPasscodeConfig.fields.Tries >= Passcode_GetMaxTries()) {
@@ -368,8 +501,8 @@ void Passcode_Set(const char *input) {
     // 2. Generate new random Salt/Nonce
     TRNG_Fill(gPasscodeConfig.fields.Nonce, 16);
     
-    // 3. Set Iterations for this new passcode
-    gPasscodeConfig.fields.Iterations = KDF_ITERATIONS;
+    // 3. Calibrate Iterations for this new passcode on this clock
+    gPasscodeConfig.fields.Iterations = CalibrateIterations();
 
     // 4. Compute Verifier
     ComputeVerifier(input, gPasscodeConfig.fields.Nonce, gPasscodeConfig.fields.Verifier);
@@ -480,6 +613,7 @@ void Passcode_Prompt(void) {
              // After wait, give the user 1 last attempt before re-locking
              gPasscodeConfig.fields.Tries = maxTries - 1;
              Passcode_SaveConfig();
+             FlushConfig();
              UI_SetStatusTitle("Enter Passcode");
              ST7565_FillScreen(0x00);
              ST7565_BlitFullScreen();
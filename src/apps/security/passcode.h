@@ -26,8 +26,9 @@ void Passcode_DeriveKEK(const char *password, uint8_t *kek_out);
 uint8_t* Passcode_GetMasterKey(void);
 uint32_t Passcode_GetMasterKeyHash(void);
 bool Passcode_IsMigrated(RecordID_t id);
-void Passcode_SetMigrated(RecordID_t id);
 void Passcode_SaveConfig(void);
+// Re-encrypts the records in mask sector by sector, false if a key is missing
+bool Passcode_MigrateRecords(uint64_t mask);
 void Passcode_MigrateStorage(void);
 
 // UI Functions
@@ -47,7 +48,7 @@ void Passcode_Change(void);  // Settings menu entry
 #define Passcode_GetMasterKey() ((uint8_t*)NULL)
 #define Passcode_GetMasterKeyHash() (0)
 #define Passcode_IsMigrated(id) (true)
-#define Passcode_SetMigrated(id)
+#define Passcode_MigrateRecords(mask) (true)
 #define Passcode_MigrateStorage()
 #define Passcode_Prompt()
 #define Passcode_Change()
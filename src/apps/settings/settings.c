@@ -251,6 +251,8 @@ void SETTINGS_InitEEPROM(void)
     } else {
         strcpy(gEeprom.REVIVE_CODE, "9DCBA");
     }
+
+    DTMF_CompileMatcher();
 #endif
 
     Storage_ReadRecord(REC_DTMF_UP_CODE, Data, 0, sizeof(gEeprom.DTMF_UP_CODE));
@@ -317,6 +319,9 @@ void SETTINGS_InitEEPROM(void)
 #ifdef ENABLE_SQUELCH_TAIL_ELIMINATION
     gEeprom.SQUELCH_TAIL_ELIMINATION = flockConfig.fields.SQUELCH_TAIL_ELIMINATION;
 #endif
+#ifdef ENABLE_DEEP_SLEEP_MODE
+    gSetting_sleep_duty = LIMIT(flockConfig.fields.SLEEP_DUTY, SLEEP_DUTY_LEN, 0);
+#endif
 
     if (!gEeprom.VFO_OPEN)
     {
@@ -820,6 +825,9 @@ void SETTINGS_SaveSettings(void)
 #ifdef ENABLE_SQUELCH_TAIL_ELIMINATION
     flockConfig.fields.SQUELCH_TAIL_ELIMINATION = gEeprom.SQUELCH_TAIL_ELIMINATION;
 #endif
+#ifdef ENABLE_DEEP_SLEEP_MODE
+    flockConfig.fields.SLEEP_DUTY = gSetting_sleep_duty;
+#endif
 
     Storage_WriteRecord(REC_F_LOCK, flockConfig.raw, 0, sizeof(flockConfig.raw));
 
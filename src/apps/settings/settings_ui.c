@@ -79,6 +79,9 @@ static const SettingConfig settingConfigs[] = {
     {MENU_SET_LCK,  SET_TYPE_BOOL,  &gSetting_set_lck, 0, 1, gSubMenu_SET_LCK, 9},
     {MENU_SET_TMR,  SET_TYPE_BOOL,  &gSetting_set_tmr, 0, 1, gSubMenu_OFF_ON, 4},
     {MENU_SET_AUD,  SET_TYPE_LIST,  &gSetting_set_audio, 0, 4, gSubMenu_SET_AUD, 6},
+#ifdef ENABLE_DEEP_SLEEP_MODE
+    {MENU_SET_DTY,  SET_TYPE_LIST,  &gSetting_sleep_duty, 0, SLEEP_DUTY_LEN - 1, gSubMenu_SET_DTY, 7},
+#endif
     {MENU_BATTYP,   SET_TYPE_LIST,  &gEeprom.BATTERY_TYPE, 0, 4, gSubMenu_BATTYP, 12},
     {MENU_D_ST,     SET_TYPE_BOOL,  &gEeprom.DTMF_SIDE_TONE, 0, 1, gSubMenu_OFF_ON, 4},
     {MENU_D_LIVE_DEC, SET_TYPE_BOOL, &gSetting_live_DTMF_decoder, 0, 1, gSubMenu_OFF_ON, 4},
@@ -486,6 +489,9 @@ static bool Action_FactoryReset(const MenuItem *item, KEY_Code_t key, bool key_p
                 }
                 if (k == KEY_MENU) {
                      SETTINGS_FactoryReset(resetAll);
+#ifdef ENABLE_ASYNC_FLASH
+                     PY25Q16_Flush();
+#endif
                      NVIC_SystemReset();
                      return true;
                 }
@@ -636,6 +642,7 @@ static const MenuItem systemItems[] = {
     {"Bat Type", MENU_BATTYP, getVal, changeVal, NULL, NULL, M_ITEM_SELECT},
     #ifdef ENABLE_DEEP_SLEEP_MODE
     {"Deep Sleep",  MENU_SET_OFF, getVal, changeVal, NULL, NULL, M_ITEM_SELECT},
+    {"Sleep Duty",  MENU_SET_DTY, getVal, changeVal, NULL, NULL, M_ITEM_SELECT},
     #endif
 #ifdef ENABLE_PASSCODE
     {"Passcode", MENU_PASSCODE, getVal, NULL, NULL, Action_Passcode, M_ITEM_ACTION},
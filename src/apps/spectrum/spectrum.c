@@ -7,6 +7,7 @@
 #include "features/radio/functions.h"
 #include "features/radio/radio.h"
 #include "ui/ui.h"
+#include "ui/ag_graphics.h"
 
 #define F_MIN frequencyBandTable[0].lower
 #define F_MAX frequencyBandTable[BAND_N_ELEM - 1].upper
@@ -25,6 +26,14 @@
 #endif
 #include "features/storage/storage.h"
 
+#ifdef ENABLE_SPECTRUM_STREAM
+#include "features/uart/uart.h"
+#endif
+
+#ifdef ENABLE_SPECTRUM_BANDS
+#include "apps/spectrum/spectrum_bands.h"
+#endif
+
 #ifdef ENABLE_SPECTRUM_EXTENSIONS
 #include "drivers/bsp/py25q16.h"
 #endif
@@ -177,8 +186,10 @@ static void PutPixel(uint8_t x, uint8_t y, bool fill)
 
 static void DrawVLine(int sy, int ey, int nx, bool fill)
 {
-    for (int i = sy; i <= ey; i++)
-        if (i < 56 && nx < 128) PutPixel(nx, i, fill);
+    // frame buffer rows 0..55 are screen rows 8..63
+    if (sy < 0) sy = 0;
+    if (ey > 55) ey = 55;
+    if (ey >= sy) AG_FillRect(nx, sy + 8, 1, ey - sy + 1, fill ? C_FILL : C_CLEAR);
 }
 
 static KEY_Code_t GetKey()
@@ -280,11 +291,19 @@ static bool checkIfTailFound()
 }
 #endif
 
-bool IsCenterMode() { return settings.scanStepIndex < S_STEP_2_5kHz; }
+bool IsCenterMode() {
+#ifdef ENABLE_SPECTRUM_BANDS
+    if (SPECTRUM_BANDS_IsActive()) return false;
+#endif
+    return settings.scanStepIndex < S_STEP_2_5kHz;
+}
 uint16_t GetScanStep() { return scanStepValues[settings.scanStepIndex]; }
 
 uint16_t GetStepsCount()
 {
+#ifdef ENABLE_SPECTRUM_BANDS
+    if (SPECTRUM_BANDS_IsActive()) return SPECTRUM_BANDS_GetStepsCount();
+#endif
 #ifdef ENABLE_SCAN_RANGES
     if (gScanRangeStart) {
         return ((gScanRangeStop - gScanRangeStart) / GetScanStep()) + 1;
@@ -305,8 +324,16 @@ static uint16_t GetStepsCountDisplay()
 #endif
 
 uint32_t GetBW() { return GetStepsCount() * GetScanStep(); }
-uint32_t GetFStart() { return IsCenterMode() ? currentFreq - (GetBW() >> 1) : currentFreq; }
+uint32_t GetFStart() {
+#ifdef ENABLE_SPECTRUM_BANDS
+    if (SPECTRUM_BANDS_IsActive()) return SPECTRUM_BANDS_GetStart();
+#endif
+    return IsCenterMode() ? currentFreq - (GetBW() >> 1) : currentFreq;
+}
 uint32_t GetFEnd() {
+#ifdef ENABLE_SPECTRUM_BANDS
+    if (SPECTRUM_BANDS_IsActive()) return SPECTRUM_BANDS_GetEnd();
+#endif
 #ifdef ENABLE_SCAN_RANGES
     if (gScanRangeStart) return gScanRangeStop;
 #endif
@@ -330,10 +357,18 @@ static void DeInitSpectrum()
 
 uint8_t GetBWRegValueForScan() { return scanStepBWRegValues[settings.scanStepIndex]; }
 
+static uint16_t GetScanSettleUs()
+{
+    BK4819_FilterBandwidth_t bw = settings.scanStepIndex >= S_STEP_25_0kHz ? BK4819_FILTER_BW_WIDE
+                                : settings.scanStepIndex >= S_STEP_12_5kHz ? BK4819_FILTER_BW_NARROW
+                                : BK4819_FILTER_BW_NARROWER;
+    return BK4819_GetRssiSettleUs(GetScanStep(), bw);
+}
+
 uint16_t GetRssi()
 {
-    while ((BK4819_ReadRegister(0x63) & 0b11111111) >= 255) SYSTICK_DelayUs(100);
-    uint16_t rssi = BK4819_GetRSSI();
+    // no hop while listening, only a retune needs the settle interval
+    uint16_t rssi = BK4819_AcquireRSSI(isListening ? 0 : scanInfo.settleUs, 1);
 #ifdef ENABLE_AM_FIX
     if (settings.modulationType == MODULATION_AM && gSetting_AM_fix)
         rssi += AM_fix_get_gain_diff() * 2;
@@ -376,11 +411,15 @@ static void ResetScanStats()
 
 static void InitScan()
 {
+#ifdef ENABLE_SPECTRUM_BANDS
+    SPECTRUM_BANDS_Select(gSpectrumBandPlan, GetScanStep());
+#endif
     ResetScanStats();
     scanInfo.i = 0;
     scanInfo.f = GetFStart();
     scanInfo.scanStep = GetScanStep();
     scanInfo.measurementsCount = GetStepsCount();
+    scanInfo.settleUs = GetScanSettleUs();
 }
 
 static void ResetBlacklist()
@@ -438,9 +477,9 @@ static void UpdatePeakInfo()
 
 static void SetRssiHistory(uint16_t idx, uint16_t rssi)
 {
-#ifdef ENABLE_SCAN_RANGES
+#if defined(ENABLE_SCAN_RANGES) || defined(ENABLE_SPECTRUM_BANDS)
     if (scanInfo.measurementsCount > 128) {
-        uint8_t i = (uint32_t)128 * 1000 / scanInfo.measurementsCount * idx / 1000;
+        uint8_t i = (uint32_t)idx * 128 / scanInfo.measurementsCount;
         if (rssiHistory[i] < rssi || isListening) rssiHistory[i] = rssi;
         rssiHistory[(i + 1) % 128] = 0;
         return;
@@ -490,6 +529,9 @@ static void UpdateScanStep(bool inc)
 
 static void UpdateCurrentFreq(bool inc)
 {
+#ifdef ENABLE_SPECTRUM_BANDS
+    if (SPECTRUM_BANDS_IsActive()) return;
+#endif
     if (inc && currentFreq < F_MAX) currentFreq += settings.frequencyChangeStep;
     else if (!inc && currentFreq > F_MIN) currentFreq -= settings.frequencyChangeStep;
     else return;
@@ -535,6 +577,16 @@ static void ToggleBacklight()
     else BACKLIGHT_TurnOff();
 }
 
+#ifdef ENABLE_SPECTRUM_BANDS
+static void ToggleBandPlan()
+{
+    gSpectrumBandPlan = SPECTRUM_BANDS_NextPlan(gSpectrumBandPlan);
+    RelaunchScan(); ResetBlacklist();
+    memset(rssiHistory, 0, sizeof(rssiHistory));
+    redrawScreen = true;
+}
+#endif
+
 static void ToggleStepsCount()
 {
     if (settings.stepsCount == STEPS_128) settings.stepsCount = STEPS_16;
@@ -703,6 +755,11 @@ static void DrawF(uint32_t f)
 static void DrawNums()
 {
     if (currentState == SPECTRUM) {
+#ifdef ENABLE_SPECTRUM_BANDS
+        if (SPECTRUM_BANDS_IsActive())
+            strcpy(String, SPECTRUM_BANDS_GetName());
+        else
+#endif
 #ifdef ENABLE_SCAN_RANGES
         if (gScanRangeStart) {
             NUMBER_ToDecimal(String, GetStepsCountDisplay(), 3, false);
@@ -758,6 +815,10 @@ static void DrawTicks()
     uint32_t step = span / 128;
     for (uint8_t i = 0; i < 128; i += (1 << settings.stepsCount)) {
         uint32_t f = GetFStart() + span * i / 128;
+#ifdef ENABLE_SPECTRUM_BANDS
+        // ticks follow the segments, the gaps are not on screen
+        if (SPECTRUM_BANDS_IsActive()) f = SPECTRUM_BANDS_GetFrequency((uint32_t)i * GetStepsCount() / 128);
+#endif
         uint8_t barValue = 0b00000001;
         if ((f % 10000) < step) barValue |= 0b00000010;
         if ((f % 50000) < step) barValue |= 0b00000100;
@@ -789,6 +850,9 @@ static void OnKeyDown(uint8_t key)
     case KEY_0: ToggleModulation(); break; case KEY_6: ToggleListeningBW(); break;
     case KEY_4: ToggleStepsCount(); break; case KEY_SIDE2: ToggleBacklight(); break;
     case KEY_PTT: SetState(STILL); TuneToPeak(); break;
+#ifdef ENABLE_SPECTRUM_BANDS
+    case KEY_MENU: ToggleBandPlan(); break;
+#endif
     case KEY_EXIT: if (menuState) { menuState = 0; break; }
 #ifdef ENABLE_SPECTRUM_EXTENSIONS
         SaveSettings();
@@ -918,9 +982,50 @@ static void NextScanStep()
 {
     ++peak.t;
     ++scanInfo.i;
+#ifdef ENABLE_SPECTRUM_BANDS
+    if (SPECTRUM_BANDS_IsActive()) { scanInfo.f = SPECTRUM_BANDS_GetFrequency(scanInfo.i); return; }
+#endif
     scanInfo.f += scanInfo.scanStep;
 }
 
+#ifdef ENABLE_SPECTRUM_STREAM
+static void StreamSweep()
+{
+    uint32_t step = scanInfo.scanStep;
+    uint16_t count = scanInfo.measurementsCount;
+    uint16_t iPeak = scanInfo.iPeak;
+
+    if (count > 128)
+    {
+        // long ranges are folded into 128 history bins
+        step = (GetFEnd() - GetFStart()) / 128;
+        iPeak = (uint32_t)iPeak * 128 / count;
+        count = 128;
+    }
+
+#ifdef ENABLE_SPECTRUM_BANDS
+    // the segments leave gaps, there is no start/step axis to describe
+    if (SPECTRUM_BANDS_IsActive())
+        step = 0;
+#endif
+
+    UART_SendSpectrumSweep(GetFStart(), step, rssiHistory, count, iPeak);
+}
+
+static void PollHostCommands()
+{
+    // the app runs its own loop, stream control must be serviced here
+#ifdef ENABLE_USB
+    if (UART_IsCommandAvailable(UART_PORT_VCP))
+        UART_HandleCommand(UART_PORT_VCP);
+#endif
+#ifdef ENABLE_UART
+    if (UART_IsCommandAvailable(UART_PORT_UART))
+        UART_HandleCommand(UART_PORT_UART);
+#endif
+}
+#endif
+
 static void UpdateScan()
 {
     Scan();
@@ -938,6 +1043,10 @@ static void UpdateScan()
     redrawScreen = true;
     preventKeypress = false;
 
+#ifdef ENABLE_SPECTRUM_STREAM
+    StreamSweep();
+#endif
+
     UpdatePeakInfo();
     if (IsPeakOverLevel())
     {
@@ -969,6 +1078,10 @@ static void UpdateListening()
 
 static void Tick()
 {
+#ifdef ENABLE_SPECTRUM_STREAM
+    PollHostCommands();
+#endif
+
 #ifdef ENABLE_AM_FIX
     if (gNextTimeslice) { gNextTimeslice = false; if (settings.modulationType == MODULATION_AM && !lockAGC) AM_fix_10ms(vfo); }
 #endif
@@ -989,6 +1102,9 @@ void APP_RunSpectrum()
     vfo = gEeprom.TX_VFO;
 #ifdef ENABLE_SPECTRUM_EXTENSIONS
     LoadSettings();
+#endif
+#ifdef ENABLE_SPECTRUM_BANDS
+    gSpectrumBandPlan = SPECTRUM_BANDS_OFF;
 #endif
     currentFreq = initialFreq = gTxVfo->pRX->Frequency - ((GetStepsCount() / 2) * GetScanStep());
 #ifdef ENABLE_BOOT_RESUME_STATE
@@ -1002,5 +1118,10 @@ void APP_RunSpectrum()
     RelaunchScan();
     memset(rssiHistory, 0, sizeof(rssiHistory));
     isInitialized = true;
-    while (isInitialized) Tick();
+    while (isInitialized) {
+        Tick();
+#ifdef ENABLE_ASYNC_FLASH
+        PY25Q16_Poll();
+#endif
+    }
 }
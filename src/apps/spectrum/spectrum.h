@@ -151,6 +151,7 @@ typedef struct ScanInfo
     uint32_t f, fPeak;
     uint16_t scanStep;
     uint16_t measurementsCount;
+    uint16_t settleUs;
 } ScanInfo;
 
 typedef struct PeakInfo
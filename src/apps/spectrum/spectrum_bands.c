@@ -0,0 +1,143 @@
+/* Copyright 2025 deltafw
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include "apps/spectrum/spectrum_bands.h"
+#include "features/radio/frequencies.h"
+#include "core/misc.h"
+
+#define BAND(x) (1u << (x))
+
+typedef struct {
+    const char *name;
+    uint8_t     bands;      // SERVICE_Band_t bit mask
+} BandPlan_t;
+
+// Plans are fixed at build time: edit this table (and serviceBandTable for
+// new segments) to define your own. Entry 0 is the plain contiguous sweep.
+static const BandPlan_t bandPlans[] = {
+    [SPECTRUM_BANDS_OFF] = {"",     0},
+    {"2m/70",  BAND(SERVICE_BAND_2M) | BAND(SERVICE_BAND_70CM)},
+    {"V/U+PMR", BAND(SERVICE_BAND_2M) | BAND(SERVICE_BAND_70CM) | BAND(SERVICE_BAND_PMR446)},
+    {"AIR+2m", BAND(SERVICE_BAND_AIR) | BAND(SERVICE_BAND_2M)},
+    {"MAR+2m", BAND(SERVICE_BAND_MARINE) | BAND(SERVICE_BAND_2M)},
+    {"ALL",    BAND(SERVICE_BAND_AIR) | BAND(SERVICE_BAND_2M) | BAND(SERVICE_BAND_MARINE) |
+               BAND(SERVICE_BAND_70CM) | BAND(SERVICE_BAND_PMR446)},
+};
+
+typedef struct {
+    uint32_t start;
+    uint16_t bins;
+} Segment_t;
+
+uint8_t gSpectrumBandPlan = SPECTRUM_BANDS_OFF;
+
+static Segment_t segments[SERVICE_BAND_N_ELEM];
+static uint8_t   segmentCount;
+static uint16_t  segmentStep;
+static uint16_t  totalBins;
+
+void SPECTRUM_BANDS_Select(uint8_t plan, uint16_t step)
+{
+    if (plan >= ARRAY_SIZE(bandPlans))
+        plan = SPECTRUM_BANDS_OFF;
+
+    gSpectrumBandPlan = plan;
+    segmentStep = step ? step : 1;
+    segmentCount = 0;
+    totalBins = 0;
+
+    // serviceBandTable is in ascending order, so is the composite sweep
+    for (uint8_t band = 0; band < SERVICE_BAND_N_ELEM; band++)
+    {
+        if (!(bandPlans[plan].bands & BAND(band)))
+            continue;
+
+        const freq_band_table_t *pBand = &serviceBandTable[band];
+        uint32_t bins = (pBand->upper - pBand->lower) / segmentStep + 1;
+
+        // fine steps over wide plans would overflow the bin index
+        if (bins > UINT16_MAX - totalBins)
+            bins = UINT16_MAX - totalBins;
+        if (!bins)
+            break;
+
+        segments[segmentCount].start = pBand->lower;
+        segments[segmentCount].bins  = bins;
+        totalBins += bins;
+        segmentCount++;
+    }
+}
+
+uint8_t SPECTRUM_BANDS_NextPlan(uint8_t plan)
+{
+    return (plan + 1) % ARRAY_SIZE(bandPlans);
+}
+
+const char *SPECTRUM_BANDS_GetName(void)
+{
+    return bandPlans[gSpectrumBandPlan].name;
+}
+
+uint16_t SPECTRUM_BANDS_GetStepsCount(void)
+{
+    return totalBins;
+}
+
+uint32_t SPECTRUM_BANDS_GetFrequency(uint16_t idx)
+{
+    for (uint8_t i = 0; i < segmentCount; i++)
+    {
+        if (idx < segments[i].bins)
+            return segments[i].start + (uint32_t)idx * segmentStep;
+        idx -= segments[i].bins;
+    }
+
+    return SPECTRUM_BANDS_GetEnd();
+}
+
+// nearest bin at or below f, frequencies in a gap map to the end of the
+// segment before it
+uint16_t SPECTRUM_BANDS_GetIndex(uint32_t f)
+{
+    uint16_t idx = 0;
+
+    for (uint8_t i = 0; i < segmentCount; i++)
+    {
+        const Segment_t *pSeg = &segments[i];
+        if (f < pSeg->start)
+            return idx ? idx - 1 : 0;
+
+        uint32_t offset = (f - pSeg->start) / segmentStep;
+        if (offset < pSeg->bins)
+            return idx + offset;
+        idx += pSeg->bins;
+    }
+
+    return idx ? idx - 1 : 0;
+}
+
+uint32_t SPECTRUM_BANDS_GetStart(void)
+{
+    return segmentCount ? segments[0].start : 0;
+}
+
+uint32_t SPECTRUM_BANDS_GetEnd(void)
+{
+    if (!segmentCount)
+        return 0;
+
+    const Segment_t *pLast = &segments[segmentCount - 1];
+    return pLast->start + (uint32_t)(pLast->bins - 1) * segmentStep;
+}
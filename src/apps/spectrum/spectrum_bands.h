@@ -0,0 +1,44 @@
+/* Copyright 2025 deltafw
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef SPECTRUM_BANDS_H
+#define SPECTRUM_BANDS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Segmented spectrum sweep: a band plan is a set of disjoint service bands
+// (serviceBandTable) swept back to back as one composite display. Bin
+// indices run across all segments, the gaps between them are never visited.
+
+#define SPECTRUM_BANDS_OFF  0
+
+void        SPECTRUM_BANDS_Select(uint8_t plan, uint16_t step);
+uint8_t     SPECTRUM_BANDS_NextPlan(uint8_t plan);
+const char *SPECTRUM_BANDS_GetName(void);
+
+uint16_t    SPECTRUM_BANDS_GetStepsCount(void);
+uint32_t    SPECTRUM_BANDS_GetFrequency(uint16_t idx);
+uint16_t    SPECTRUM_BANDS_GetIndex(uint32_t f);
+uint32_t    SPECTRUM_BANDS_GetStart(void);
+uint32_t    SPECTRUM_BANDS_GetEnd(void);
+
+extern uint8_t gSpectrumBandPlan;
+
+static inline bool SPECTRUM_BANDS_IsActive(void) {
+    return gSpectrumBandPlan != SPECTRUM_BANDS_OFF;
+}
+
+#endif
@@ -21,6 +21,7 @@
 #include "features/radio/functions.h"
 #include "features/radio/radio.h"
 #include "ui/ui.h"
+#include "ui/ag_graphics.h"
 
 #ifdef ENABLE_SPECTRUM_ADVANCED
 // Utility: Set LED color based on frequency and TX/RX state
@@ -52,6 +53,7 @@ static void SetBandLed(uint32_t freq, bool isTx, bool hasSignal)
 #endif
 
 #ifdef ENABLE_SPECTRUM_ADVANCED
+#include <assert.h>
 #include <string.h>
 #include "drivers/bsp/py25q16.h"
 #endif
@@ -70,6 +72,14 @@ static void SetBandLed(uint32_t freq, bool isTx, bool hasSignal)
 #endif
 #include "features/storage/storage.h"
 
+#ifdef ENABLE_SPECTRUM_STREAM
+#include "features/uart/uart.h"
+#endif
+
+#ifdef ENABLE_SPECTRUM_BANDS
+#include "apps/spectrum/spectrum_bands.h"
+#endif
+
 #ifdef ENABLE_SPECTRUM_EXTENSIONS
 #include "drivers/bsp/py25q16.h"
 #endif
@@ -85,8 +95,16 @@ struct FrequencyBandInfo
 #define F_MAX frequencyBandTable[BAND_N_ELEM - 1].upper
 
 #ifdef ENABLE_SPECTRUM_ADVANCED
-/** @brief Number of waterfall history lines */
-#define WATERFALL_HISTORY_DEPTH     16U
+/** @brief Maximum number of waterfall history lines kept */
+#define WATERFALL_HISTORY_DEPTH     54U
+/** @brief History lines merged into one drawn waterfall row */
+#define WATERFALL_LINES_PER_ROW     3U
+/** @brief RAM of the old 128x8 waterfall array, ring plus bookkeeping */
+#define WATERFALL_RAM_BUDGET        1024U
+/** @brief Size of the compressed waterfall byte ring, 15 raw lines at worst */
+#define WATERFALL_STORE_SIZE        (15U * (64U + 2U))
+/** @brief Lowest level drawn for a non-floor sample */
+#define WATERFALL_LEVEL_FLOOR       3U
 /** @brief Minimum dBm value for display */
 #define DISPLAY_DBM_MIN             -130
 /** @brief Maximum dBm value for display */
@@ -127,10 +145,20 @@ static uint8_t blacklistFreqsIdx;
 
 #ifdef ENABLE_SPECTRUM_ADVANCED
 static uint16_t displayRssi = 0;             /**< Filtered RSSI for display to reduce flickering */
-uint8_t waterfallHistory[128][WATERFALL_HISTORY_DEPTH / 2]; /**< 4-bit packed waterfall (2 samples/byte) */
+/**
+ * Compressed waterfall history. Each line is stored as [hdr][payload][hdr]
+ * where payload is either run-length tokens ((run - 1) << 4 | level) or,
+ * if that would be longer, the 64 byte 4-bit packed line (hdr bit 7 set).
+ * The trailing hdr lets DrawWaterfall walk back from the newest line.
+ */
+static uint8_t waterfallStore[WATERFALL_STORE_SIZE];
+static uint16_t waterfallHead;               /**< Offset one past the newest line */
+static uint16_t waterfallUsed;               /**< Bytes held in the ring */
+static uint8_t waterfallLines;               /**< Lines held in the ring */
+static_assert(WATERFALL_STORE_SIZE + sizeof(waterfallHead) + sizeof(waterfallUsed) + sizeof(waterfallLines) <= WATERFALL_RAM_BUDGET,
+              "waterfall history exceeds the old waterfall RAM");
 static uint16_t peakHold[128] = {0};
 static uint8_t peakHoldAge[64]; // Shared timer to save RAM (1 byte per 2 bins)
-uint8_t waterfallIndex = 0;                  /**< Current waterfall line index (0 to WATERFALL_HISTORY_DEPTH-1) */
 #endif
 
 const char *bwOptions[] = {"25", "12.5", "6.25"};
@@ -265,23 +293,13 @@ static void SetRegMenuValue(uint8_t st, bool add)
 
 // GUI functions
 
-#ifndef ENABLE_CUSTOM_FIRMWARE_MODS
-static void PutPixel(uint8_t x, uint8_t y, bool fill)
-{
-    UI_DrawPixelBuffer(gFrameBuffer, x, y, fill);
-}
-#endif
-
 #ifndef ENABLE_SPECTRUM_ADVANCED
 static void DrawVLine(int sy, int ey, int nx, bool fill)
 {
-    for (int i = sy; i <= ey; i++)
-    {
-        if (i < 56 && nx < 128)
-        {
-            PutPixel(nx, i, fill);
-        }
-    }
+    // frame buffer rows 0..55 are screen rows 8..63
+    if (sy < 0) sy = 0;
+    if (ey > 55) ey = 55;
+    if (ey >= sy) AG_FillRect(nx, sy + 8, 1, ey - sy + 1, fill ? C_FILL : C_CLEAR);
 }
 #endif
 
@@ -422,12 +440,25 @@ static void ResetPeak()
     }
 #endif
 
-bool IsCenterMode() { return settings.scanStepIndex < S_STEP_2_5kHz; }
+bool IsCenterMode()
+{
+#ifdef ENABLE_SPECTRUM_BANDS
+    if (SPECTRUM_BANDS_IsActive())
+        return false;
+#endif
+    return settings.scanStepIndex < S_STEP_2_5kHz;
+}
 // scan step in 0.01khz
 uint16_t GetScanStep() { return scanStepValues[settings.scanStepIndex]; }
 
 uint16_t GetStepsCount()
 {
+#ifdef ENABLE_SPECTRUM_BANDS
+    if (SPECTRUM_BANDS_IsActive())
+    {
+        return SPECTRUM_BANDS_GetStepsCount();
+    }
+#endif
 #ifdef ENABLE_SCAN_RANGES
     if (gScanRangeStart)
     {
@@ -453,11 +484,23 @@ static uint16_t GetStepsCountDisplay()
 uint32_t GetBW() { return GetStepsCount() * GetScanStep(); }
 uint32_t GetFStart()
 {
+#ifdef ENABLE_SPECTRUM_BANDS
+    if (SPECTRUM_BANDS_IsActive())
+    {
+        return SPECTRUM_BANDS_GetStart();
+    }
+#endif
     return IsCenterMode() ? currentFreq - (GetBW() >> 1) : currentFreq;
 }
 
 uint32_t GetFEnd()
 {
+#ifdef ENABLE_SPECTRUM_BANDS
+    if (SPECTRUM_BANDS_IsActive())
+    {
+        return SPECTRUM_BANDS_GetEnd();
+    }
+#endif
 #ifdef ENABLE_SCAN_RANGES
     if (gScanRangeStart)
     {
@@ -485,15 +528,23 @@ uint8_t GetBWRegValueForScan()
     return scanStepBWRegValues[settings.scanStepIndex];
 }
 
+static uint16_t GetScanSettleUs()
+{
+    BK4819_FilterBandwidth_t bw;
+    if (settings.scanStepIndex >= S_STEP_25_0kHz)
+        bw = BK4819_FILTER_BW_WIDE;
+    else if (settings.scanStepIndex >= S_STEP_12_5kHz)
+        bw = BK4819_FILTER_BW_NARROW;
+    else
+        bw = BK4819_FILTER_BW_NARROWER;
+    return BK4819_GetRssiSettleUs(GetScanStep(), bw);
+}
+
 uint16_t GetRssi()
 {
-    // SYSTICK_DelayUs(800);
-    // testing autodelay based on Glitch value
-    while ((BK4819_ReadRegister(0x63) & 0b11111111) >= 255)
-    {
-        SYSTICK_DelayUs(100);
-    }
-    uint16_t rssi = BK4819_GetRSSI();
+    // wait the predicted PLL/filter settle time once after a retune, the
+    // driver bounds any further wait for a valid glitch indicator
+    uint16_t rssi = BK4819_AcquireRSSI(isListening ? 0 : scanInfo.settleUs, 1);
 #ifdef ENABLE_AM_FIX
     if (settings.modulationType == MODULATION_AM && gSetting_AM_fix)
         rssi += AM_fix_get_gain_diff() * 2;
@@ -577,12 +628,16 @@ static void ResetScanStats()
 
 static void InitScan()
 {
+#ifdef ENABLE_SPECTRUM_BANDS
+    SPECTRUM_BANDS_Select(gSpectrumBandPlan, GetScanStep());
+#endif
     ResetScanStats();
     scanInfo.i = 0;
     scanInfo.f = GetFStart();
 
     scanInfo.scanStep = GetScanStep();
     scanInfo.measurementsCount = GetStepsCount();
+    scanInfo.settleUs = GetScanSettleUs();
     scanInfo.rssiMin = RSSI_MAX_VALUE;
 }
 
@@ -681,9 +736,85 @@ static void UpdatePeakInfo()
 }
 
 #ifdef ENABLE_SPECTRUM_ADVANCED
+#define WF_WRAP(x)  WrapStore((int32_t)(x))
+#define WF_RAW      0x80
+
+// Positions never stray more than one store length out of range
+static inline uint16_t WrapStore(int32_t x)
+{
+    if (x < 0)
+        x += WATERFALL_STORE_SIZE;
+    else if (x >= (int32_t)WATERFALL_STORE_SIZE)
+        x -= WATERFALL_STORE_SIZE;
+    return (uint16_t)x;
+}
+
+static void ResetWaterfall(void)
+{
+    waterfallHead = 0;
+    waterfallUsed = 0;
+    waterfallLines = 0;
+}
+
+static void PushWaterfallLine(const uint8_t *payload, uint8_t hdr)
+{
+    const uint8_t len = hdr & 0x7F;
+    const uint16_t size = len + 2;
+
+    // evict the oldest lines until the new one fits
+    while (waterfallLines && (waterfallUsed + size > WATERFALL_STORE_SIZE || waterfallLines >= WATERFALL_HISTORY_DEPTH))
+    {
+        const uint8_t oldHdr = waterfallStore[WF_WRAP(waterfallHead - waterfallUsed)];
+        waterfallUsed -= (oldHdr & 0x7F) + 2;
+        waterfallLines--;
+    }
+
+    waterfallStore[waterfallHead] = hdr;
+    for (uint8_t i = 0; i < len; i++)
+        waterfallStore[WF_WRAP(waterfallHead + 1 + i)] = payload[i];
+    waterfallStore[WF_WRAP(waterfallHead + 1 + len)] = hdr;
+
+    waterfallHead = WF_WRAP(waterfallHead + size);
+    waterfallUsed += size;
+    waterfallLines++;
+}
+
+// Decodes the line ending at 'end' into 128 levels, returns where it starts
+static uint16_t ReadWaterfallLine(uint16_t end, uint8_t *levels)
+{
+    const uint8_t hdr = waterfallStore[WF_WRAP(end - 1)];
+    const uint8_t len = hdr & 0x7F;
+    const uint16_t start = WF_WRAP(end - len - 2);
+    uint16_t pos = WF_WRAP(start + 1);
+
+    if (hdr & WF_RAW)
+    {
+        for (uint8_t i = 0; i < 128; i += 2, pos = WF_WRAP(pos + 1))
+        {
+            levels[i] = waterfallStore[pos] & 0x0F;
+            levels[i + 1] = waterfallStore[pos] >> 4;
+        }
+        return start;
+    }
+
+    uint8_t x = 0;
+    for (uint8_t i = 0; i < len; i++, pos = WF_WRAP(pos + 1))
+    {
+        const uint8_t token = waterfallStore[pos];
+        for (uint8_t run = (token >> 4) + 1; run && x < 128; run--)
+            levels[x++] = token & 0x0F;
+    }
+    while (x < 128)
+        levels[x++] = 0;
+
+    return start;
+}
+
 static void UpdateWaterfall(void)
 {
-    waterfallIndex = (waterfallIndex + 1) % WATERFALL_HISTORY_DEPTH;
+    uint8_t levels[128];
+    uint8_t payload[64];
+    uint8_t len = 0;
 
     uint16_t minRssi = 65535, maxRssi = 0;
     uint32_t sumRssi = 0;
@@ -704,41 +835,62 @@ static void UpdateWaterfall(void)
     for (uint8_t x = 0; x < 128; x++)
     {
         uint16_t rssi = rssiHistory[x];
-        uint8_t level;
+        uint8_t level = 0;
 
-        if (rssi == RSSI_MAX_VALUE || rssi == 0)
-        {
-            level = 0;
-        }
-        else if (validSamples > 0)
+        if (rssi != RSSI_MAX_VALUE && rssi != 0 && validSamples > 0)
         {
             uint16_t range = (maxRssi > minRssi) ? (maxRssi - minRssi) : 1;
             uint32_t normalized = ((rssi - minRssi) * 15) / range;
             level = (uint8_t)(normalized & 0x0F);
-            if (level > 0 && level < 3) level = 3;
-        }
-        else
-        {
-            level = 0;
+            // keep weak signals visible above the floor
+            if (level > 0 && level < WATERFALL_LEVEL_FLOOR) level = WATERFALL_LEVEL_FLOOR;
         }
 
-        // Pack 4-bit level into waterfall history (2 levels per byte)
-        uint8_t *pPacked = &waterfallHistory[x][waterfallIndex / 2];
-        if (waterfallIndex % 2 == 0) {
-            *pPacked = (*pPacked & 0xF0) | (level & 0x0F);
-        } else {
-            *pPacked = (*pPacked & 0x0F) | (level << 4);
-        }
+        levels[x] = level;
+    }
+
+    // run-length encode, falling back to 4-bit packing if that is shorter
+    for (uint8_t x = 0; x < 128 && len <= sizeof(payload); )
+    {
+        uint8_t run = 1;
+        while (run < 16 && x + run < 128 && levels[x + run] == levels[x])
+            run++;
+        if (len < sizeof(payload))
+            payload[len] = ((run - 1) << 4) | levels[x];
+        len++;
+        x += run;
+    }
+
+    if (len > sizeof(payload))
+    {
+        for (uint8_t i = 0; i < 64; i++)
+            payload[i] = levels[2 * i] | (levels[2 * i + 1] << 4);
+        PushWaterfallLine(payload, WF_RAW | 64);
+    }
+    else
+    {
+        PushWaterfallLine(payload, len);
     }
 }
 #endif
 
+// rssiHistory bin of a sweep index. Sweeps over 128 steps fold into the
+// 128 bins, and the index one past the last step stays inside the array.
+static uint8_t HistoryBin(uint16_t idx)
+{
+#if defined(ENABLE_SCAN_RANGES) || defined(ENABLE_SPECTRUM_BANDS)
+    if (scanInfo.measurementsCount > 128)
+        idx = (uint32_t)idx * 128 / scanInfo.measurementsCount;
+#endif
+    return idx < 128 ? idx : 127;
+}
+
 static void SetRssiHistory(uint16_t idx, uint16_t rssi)
 {
-#ifdef ENABLE_SCAN_RANGES
+#if defined(ENABLE_SCAN_RANGES) || defined(ENABLE_SPECTRUM_BANDS)
     if (scanInfo.measurementsCount > 128)
     {
-        uint8_t i = (uint32_t)128 * 1000 / scanInfo.measurementsCount * idx / 1000;
+        uint8_t i = HistoryBin(idx);
         if (rssiHistory[i] < rssi || isListening)
             rssiHistory[i] = rssi;
         rssiHistory[(i + 1) % 128] = 0;
@@ -751,7 +903,7 @@ static void SetRssiHistory(uint16_t idx, uint16_t rssi)
         return;
     }
 #endif
-    rssiHistory[idx] = rssi;
+    rssiHistory[HistoryBin(idx)] = rssi;
 #ifdef ENABLE_SPECTRUM_ADVANCED
     if (currentState == SPECTRUM) {
         static uint8_t wf_counter2 = 0;
@@ -833,6 +985,12 @@ static void UpdateScanStep(bool inc)
 
 static void UpdateCurrentFreq(bool inc)
 {
+#ifdef ENABLE_SPECTRUM_BANDS
+    if (SPECTRUM_BANDS_IsActive())
+    {
+        return;
+    }
+#endif
     if (inc && currentFreq < F_MAX)
     {
         currentFreq += settings.frequencyChangeStep;
@@ -926,6 +1084,17 @@ static void ToggleBacklight()
     }
 }
 
+#ifdef ENABLE_SPECTRUM_BANDS
+static void ToggleBandPlan()
+{
+    gSpectrumBandPlan = SPECTRUM_BANDS_NextPlan(gSpectrumBandPlan);
+    RelaunchScan();
+    ResetBlacklist();
+    memset(rssiHistory, 0, sizeof(rssiHistory));
+    redrawScreen = true;
+}
+#endif
+
 static void ToggleStepsCount()
 {
     if (settings.stepsCount == STEPS_128)
@@ -1079,16 +1248,28 @@ static void DrawWaterfall(void)
     const uint8_t WATERFALL_START_Y = 41;
     const uint8_t WATERFALL_HEIGHT = 19;
     const uint8_t WATERFALL_WIDTH = 128;
-    const uint16_t SPEC_WIDTH = GetStepsCount();
+    // history lines are already folded to 128 bins
+    const uint16_t SPEC_WIDTH = MIN(GetStepsCount(), WATERFALL_WIDTH);
     // const float xScale = (float)SPEC_WIDTH / WATERFALL_WIDTH;
 
+    uint8_t line[128];
+    uint8_t row[128];
+    uint16_t pos = waterfallHead;
+    uint8_t linesLeft = waterfallLines;
+
     for (uint8_t y_offset = 0; y_offset < WATERFALL_HEIGHT - 1; y_offset++)
     {
-        int8_t historyRow = (int8_t)waterfallIndex - (int8_t)y_offset;
-        if (historyRow < 0) historyRow += WATERFALL_HISTORY_DEPTH;
-
         uint8_t y_pos = WATERFALL_START_Y + y_offset;
-        if (y_pos > 63) break;
+        if (y_pos > 63 || linesLeft == 0) break;
+
+        // peak-hold the lines folded into this row so short bursts survive
+        memset(row, 0, sizeof(row));
+        for (uint8_t k = 0; k < WATERFALL_LINES_PER_ROW && linesLeft; k++, linesLeft--)
+        {
+            pos = ReadWaterfallLine(pos, line);
+            for (uint8_t x = 0; x < 128; x++)
+                if (line[x] > row[x]) row[x] = line[x];
+        }
 
         uint8_t fadeFactor = (uint8_t)(((uint16_t)(WATERFALL_HEIGHT - 1 - y_offset) * 16) / (WATERFALL_HEIGHT - 1));
 
@@ -1097,13 +1278,9 @@ static void DrawWaterfall(void)
             uint16_t specIdx = (uint16_t)(((uint32_t)x * SPEC_WIDTH) / WATERFALL_WIDTH);
             if (specIdx >= SPEC_WIDTH - 1) specIdx = SPEC_WIDTH - 2;
             
-            // Unpack 4-bit levels
-            uint8_t val0 = waterfallHistory[specIdx][historyRow / 2];
-            uint8_t l0 = (historyRow % 2 == 0) ? (val0 & 0x0F) : (val0 >> 4);
-            
-            uint8_t val1 = waterfallHistory[specIdx + 1][historyRow / 2];
-            uint8_t l1 = (historyRow % 2 == 0) ? (val1 & 0x0F) : (val1 >> 4);
-            
+            uint8_t l0 = row[specIdx];
+            uint8_t l1 = row[specIdx + 1];
+
             uint16_t fracNumerator = (uint16_t)(((uint32_t)x * SPEC_WIDTH * 256) / WATERFALL_WIDTH) % 256;
             uint16_t interpValue = ((uint16_t)l0 * (256 - fracNumerator) + (uint16_t)l1 * fracNumerator) / 256;
             uint8_t level = (uint8_t)(((interpValue * fadeFactor) / 16) & 0x0F);
@@ -1399,13 +1576,23 @@ static void JumpToNextPeak(bool inc)
     
     // Find current index in rssiHistory
     uint16_t currentIdx = (uint16_t)(128u * (fMeasure - GetFStart()) / span);
+#ifdef ENABLE_SPECTRUM_BANDS
+    if (SPECTRUM_BANDS_IsActive())
+        currentIdx = (uint32_t)SPECTRUM_BANDS_GetIndex(fMeasure) * 128 / steps;
+#endif
     if (currentIdx >= 128) currentIdx = 0;
 
     int8_t dir = inc ? 1 : -1;
     for (int i = 1; i < 128; i++) {
         uint8_t idx = (currentIdx + i * dir + 256) % 128;
         if (rssiHistory[idx] > settings.rssiTriggerLevel && rssiHistory[idx] != RSSI_MAX_VALUE) {
-            SetF(GetFStart() + (uint32_t)idx * span / 128);
+            uint32_t f = GetFStart() + (uint32_t)idx * span / 128;
+#ifdef ENABLE_SPECTRUM_BANDS
+            // bins are spread over segments, the span includes the gaps
+            if (SPECTRUM_BANDS_IsActive())
+                f = SPECTRUM_BANDS_GetFrequency((uint32_t)idx * steps / 128);
+#endif
+            SetF(f);
             if (currentState == SPECTRUM) ToggleRX(true);
             redrawScreen = true;
         }
@@ -1417,6 +1604,13 @@ static void DrawNums()
 
     if (currentState == SPECTRUM)
     {
+#ifdef ENABLE_SPECTRUM_BANDS
+        if (SPECTRUM_BANDS_IsActive())
+        {
+            strcpy(String, SPECTRUM_BANDS_GetName());
+        }
+        else
+#endif
 #ifdef ENABLE_SCAN_RANGES
         if (gScanRangeStart)
         {
@@ -1502,6 +1696,11 @@ static void DrawTicks()
     for (uint8_t i = 0; i < 128; i += (1 << settings.stepsCount))
     {
         f = GetFStart() + span * i / 128;
+#ifdef ENABLE_SPECTRUM_BANDS
+        // ticks follow the segments, the gaps are not on screen
+        if (SPECTRUM_BANDS_IsActive())
+            f = SPECTRUM_BANDS_GetFrequency((uint32_t)i * GetStepsCount() / 128);
+#endif
 #ifdef ENABLE_SPECTRUM_ADVANCED
         uint8_t barValue = 0b00010000; // Bit 4 (Pixel 28)
         if ((f % 10000) < step)  barValue |= 0b00100000; // Pixel 29
@@ -1631,6 +1830,9 @@ static void OnKeyDown(uint8_t key)
                 case KEY_3: UpdateDBMax(true); break;
                 case KEY_9: UpdateDBMax(false); break;
                 case KEY_4: ToggleStepsCount(); break;
+#ifdef ENABLE_SPECTRUM_BANDS
+                case KEY_5: ToggleBandPlan(); break;
+#endif
                 case KEY_6: ToggleListeningBW(); break;
                 case KEY_STAR: UpdateRssiTriggerLevel(false); break;
                 default: break;
@@ -2019,7 +2221,7 @@ static bool HandleUserInput()
 
 static void Scan()
 {
-    if (rssiHistory[scanInfo.i] != RSSI_MAX_VALUE
+    if (rssiHistory[HistoryBin(scanInfo.i)] != RSSI_MAX_VALUE
 #ifdef ENABLE_SCAN_RANGES
         && !IsBlacklisted(scanInfo.i)
 #endif
@@ -2035,21 +2237,67 @@ static void NextScanStep()
 {
     ++peak.t;
     ++scanInfo.i;
+#ifdef ENABLE_SPECTRUM_BANDS
+    if (SPECTRUM_BANDS_IsActive())
+    {
+        scanInfo.f = SPECTRUM_BANDS_GetFrequency(scanInfo.i);
+        return;
+    }
+#endif
     scanInfo.f += scanInfo.scanStep;
 }
 
+#ifdef ENABLE_SPECTRUM_STREAM
+static void StreamSweep()
+{
+    uint32_t step = scanInfo.scanStep;
+    uint16_t count = scanInfo.measurementsCount;
+    uint16_t iPeak = scanInfo.iPeak;
+
+    if (count > 128)
+    {
+        // long ranges are folded into 128 history bins
+        step = (GetFEnd() - GetFStart()) / 128;
+        iPeak = (uint32_t)iPeak * 128 / count;
+        count = 128;
+    }
+
+#ifdef ENABLE_SPECTRUM_BANDS
+    // the segments leave gaps, there is no start/step axis to describe
+    if (SPECTRUM_BANDS_IsActive())
+        step = 0;
+#endif
+
+    UART_SendSpectrumSweep(GetFStart(), step, rssiHistory, count, iPeak);
+}
+
+static void PollHostCommands()
+{
+    // the app runs its own loop, stream control must be serviced here
+#ifdef ENABLE_USB
+    if (UART_IsCommandAvailable(UART_PORT_VCP))
+        UART_HandleCommand(UART_PORT_VCP);
+#endif
+#ifdef ENABLE_UART
+    if (UART_IsCommandAvailable(UART_PORT_UART))
+        UART_HandleCommand(UART_PORT_UART);
+#endif
+}
+#endif
+
 static void UpdateScan()
 {
     Scan();
 #ifdef ENABLE_SPECTRUM_ADVANCED
     if (scanInfo.i < scanInfo.measurementsCount)
     {
-        uint8_t oldRssi = (uint8_t)rssiHistory[scanInfo.i];
-        if (scanInfo.rssi > oldRssi) rssiHistory[scanInfo.i] = scanInfo.rssi;
+        const uint8_t bin = HistoryBin(scanInfo.i);
+        uint8_t oldRssi = (uint8_t)rssiHistory[bin];
+        if (scanInfo.rssi > oldRssi) rssiHistory[bin] = scanInfo.rssi;
         else {
             const uint8_t DECAY_STEP = 2;
-            if (oldRssi > (scanInfo.rssi + DECAY_STEP)) rssiHistory[scanInfo.i] = oldRssi - DECAY_STEP;
-            else rssiHistory[scanInfo.i] = scanInfo.rssi;
+            if (oldRssi > (scanInfo.rssi + DECAY_STEP)) rssiHistory[bin] = oldRssi - DECAY_STEP;
+            else rssiHistory[bin] = scanInfo.rssi;
         }
     }
 #endif
@@ -2067,6 +2315,10 @@ static void UpdateScan()
     redrawScreen = true;
     preventKeypress = false;
 
+#ifdef ENABLE_SPECTRUM_STREAM
+    StreamSweep();
+#endif
+
     UpdatePeakInfo();
     if (IsPeakOverLevel())
     {
@@ -2131,6 +2383,10 @@ static void UpdateListening()
 
 static void Tick()
 {
+#ifdef ENABLE_SPECTRUM_STREAM
+    PollHostCommands();
+#endif
+
 #ifdef ENABLE_AM_FIX
     if (gNextTimeslice)
     {
@@ -2236,6 +2492,10 @@ void APP_RunSpectrum()
     LoadSettings();
 #endif
 
+#ifdef ENABLE_SPECTRUM_BANDS
+    gSpectrumBandPlan = SPECTRUM_BANDS_OFF;
+#endif
+
     // Capture original state for restoration on exit
     originalFreq = gTxVfo->pRX->Frequency;
     originalModulation = gTxVfo->Modulation;
@@ -2292,8 +2552,7 @@ void APP_RunSpectrum()
 
     memset(rssiHistory, 0, sizeof(rssiHistory));
 #ifdef ENABLE_SPECTRUM_ADVANCED
-    memset(waterfallHistory, 0, sizeof(waterfallHistory));
-    waterfallIndex = 0;
+    ResetWaterfall();
 #endif
 
     isInitialized = true;
@@ -2301,5 +2560,8 @@ void APP_RunSpectrum()
     while (isInitialized)
     {
         Tick();
+#ifdef ENABLE_ASYNC_FLASH
+        PY25Q16_Poll();
+#endif
     }
 }
\ No newline at end of file
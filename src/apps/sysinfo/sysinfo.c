@@ -31,6 +31,9 @@ typedef enum {
     INFO_MAC,
 #endif
     INFO_BATTERY,
+#ifdef ENABLE_BATTERY_MODEL
+    INFO_RUNTIME,
+#endif
     INFO_CHARGING,
     INFO_TEMP,
     INFO_RAM,
@@ -59,6 +62,9 @@ static const char* GetInfoLabel(InfoItem item) {
         case INFO_MAC:      return "MAC";
 #endif
         case INFO_BATTERY:  return "Battery";
+#ifdef ENABLE_BATTERY_MODEL
+        case INFO_RUNTIME:  return "Runtime";
+#endif
         case INFO_CHARGING: return "Charging";
         case INFO_TEMP:     return "Temp";
         case INFO_RAM:      return "RAM";
@@ -103,10 +109,19 @@ static void GetInfoValue(InfoItem item, char* buf, size_t buflen) {
             uint16_t voltage = gBatteryVoltageAverage;
             UI_FormatVoltage(buf, voltage * 10);
             strcat(buf, " ");
-            NUMBER_ToDecimal(buf + strlen(buf), BATTERY_VoltsToPercent(voltage), 3, false);
+            NUMBER_ToDecimal(buf + strlen(buf), BATTERY_GetPercent(), 3, false);
             strcat(buf, "%");
             break;
         }
+#ifdef ENABLE_BATTERY_MODEL
+        case INFO_RUNTIME: {
+            UI_FormatRuntime(buf, BATTERY_GetRuntimeMinutes());
+            strcat(buf, " ");
+            NUMBER_ToDecimal(buf + strlen(buf), BATTERY_GetLoad_mA(), 4, false);
+            strcat(buf, "mA");
+            break;
+        }
+#endif
         case INFO_CHARGING:
             strcpy(buf, gIsCharging ? "Yes" : "No");
             break;
@@ -248,11 +263,19 @@ void SYSINFO_Render(void) {
 #ifdef ENABLE_IDENTIFIER
     if (mShowCode) {
         RenderSerialCode();
+        AG_MENU_Invalidate();
     } else 
 #endif
     {
+        // live readings, the other rows only change on input
+        AG_MENU_InvalidateItem(INFO_BATTERY);
+#ifdef ENABLE_BATTERY_MODEL
+        AG_MENU_InvalidateItem(INFO_RUNTIME);
+#endif
+        AG_MENU_InvalidateItem(INFO_CHARGING);
+        AG_MENU_InvalidateItem(INFO_TEMP);
         AG_MENU_Render();
-        ST7565_BlitFullScreen();
+        AG_MENU_Blit();
     }
 }
 
@@ -38,6 +38,9 @@
 #include "drivers/bsp/gpio.h"
 #include "drivers/bsp/system.h"
 #include "drivers/bsp/st7565.h"
+#ifdef ENABLE_CW_ENGINE
+    #include "drivers/bsp/cw_timer.h"
+#endif
 #include "features/radio/frequencies.h"
 #include "apps/battery/battery.h"
 #include "core/misc.h"
@@ -142,7 +145,12 @@ void BOARD_ADC_Init(void)
 
 void BOARD_ADC_GetBatteryInfo(uint16_t *pVoltage)
 {
+#ifdef ENABLE_ADC_DMA
+    // 16 sample mean rounded back to the 12 bit scale of gBatteryCalibration
+    *pVoltage = (ADC_ReadOversampled(LL_ADC_CHANNEL_8) + (1U << (ADC_OVERSAMPLE_BITS - 1))) >> ADC_OVERSAMPLE_BITS;
+#else
     *pVoltage = ADC_ReadChannel(LL_ADC_CHANNEL_8);
+#endif
 }
 
 void BOARD_SWD_Enable(bool enable)
@@ -201,5 +209,11 @@ void BOARD_Init(void)
 #if defined(ENABLE_UART) || defined(ENABLED_AIRCOPY)
     CRC_Init();
 #endif
+#ifdef ENABLE_STOP_MODE
+    SYSTEM_StopInit();
+#endif
+#ifdef ENABLE_CW_ENGINE
+    CW_TIMER_Init();
+#endif
 
 }
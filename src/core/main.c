@@ -61,6 +61,7 @@
 #include "drivers/bsp/backlight.h"
 #include "drivers/bsp/bk4819.h"
 #include "drivers/bsp/gpio.h"
+#include "drivers/bsp/keyboard.h"
 #include "drivers/bsp/system.h"
 #include "drivers/bsp/systick.h"
 #include "drivers/bsp/py25q16.h"
@@ -100,6 +101,12 @@ void Main(void)
     gDTMF_String[sizeof(gDTMF_String) - 1] = 0;
 
     BK4819_Init();
+#ifdef ENABLE_BK4819_IRQ
+    BK4819_IRQ_Init();
+#endif
+#ifdef ENABLE_KEYPAD_IRQ
+    KEYBOARD_Init();
+#endif
 
     BOARD_ADC_GetBatteryInfo(&gBatteryCurrentVoltage);
 
@@ -266,6 +273,9 @@ void Main(void)
                     boot_counter_10ms = 0;
                     break;
                 }
+#ifdef ENABLE_KEYPAD_IRQ
+                __WFI(); // the key state only changes on the tick
+#endif
             }
         }
         
@@ -379,6 +389,9 @@ void Main(void)
         
     while (true) {
         APP_Update();
+#ifdef ENABLE_ASYNC_FLASH
+        PY25Q16_Poll();
+#endif
 
         if (gNextTimeslice) {
 
@@ -388,5 +401,10 @@ void Main(void)
                 APP_TimeSlice500ms();
             }
         }
+#ifdef ENABLE_STOP_MODE
+        else {
+            APP_PowerSaveStop();
+        }
+#endif
     }
 }
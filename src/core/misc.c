@@ -112,6 +112,7 @@ enum BacklightOnRxTx_t gSetting_backlight_on_tx_rx;
 
 #ifdef ENABLE_DEEP_SLEEP_MODE 
     uint8_t       gSetting_set_off = 1;
+    uint8_t       gSetting_sleep_duty;
     bool          gWakeUp = false;
 #endif
 
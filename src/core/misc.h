@@ -165,7 +165,9 @@ extern enum BacklightOnRxTx_t gSetting_backlight_on_tx_rx;
 #endif
 
 #ifdef ENABLE_DEEP_SLEEP_MODE 
+    #define SLEEP_DUTY_LEN 5
     extern uint8_t           gSetting_set_off;
+    extern uint8_t           gSetting_sleep_duty;
     extern bool              gWakeUp;
 #endif
 
@@ -28,6 +28,9 @@
 
 #include "drivers/bsp/backlight.h"
 #include "drivers/bsp/gpio.h"
+#ifdef ENABLE_KEYPAD_IRQ
+    #include "drivers/bsp/keyboard.h"
+#endif
 
 #define DECREMENT(cnt) \
     do {               \
@@ -49,6 +52,8 @@ uint32_t SYSTICK_GetTick(void)
     return gGlobalSysTickCounter;
 }
 
+static void Tick(void);
+
 // we come here every 10ms
 void SysTick_Handler(void)
 {
@@ -56,6 +61,37 @@ void SysTick_Handler(void)
     
     gNextTimeslice = true;
 
+#ifdef ENABLE_KEYPAD_IRQ
+    KEYBOARD_Tick();
+#endif
+
+    Tick();
+}
+
+#ifdef ENABLE_STOP_MODE
+// Runs the countdowns for ticks the core spent in STOP. Call with interrupts
+// masked. The keypad is left out, it was not bouncing while we slept.
+// Tick() keeps the 500 ms countdowns it owns exact, but however many 500 ms
+// slices went by, gNextTimeslice_500ms runs APP_TimeSlice500ms() only once.
+// The countdowns in there (key lock, sleep mode, ...) stretch by the stop.
+uint16_t SCHEDULER_CatchUp(uint16_t Ticks)
+{
+    uint16_t Slices = gNextTimeslice_500ms;
+
+    while (Ticks--) {
+        gGlobalSysTickCounter++;
+        Tick();
+        if ((gGlobalSysTickCounter % 50) == 0)
+            Slices++;
+    }
+    gNextTimeslice = true;
+
+    return Slices ? Slices - 1 : 0;
+}
+#endif
+
+static void Tick(void)
+{
     if ((gGlobalSysTickCounter % 50) == 0) {
         gNextTimeslice_500ms = true;
 
@@ -104,10 +140,6 @@ void SysTick_Handler(void)
 
     DECREMENT_AND_TRIGGER(gTailNoteEliminationCountdown_10ms, gFlagTailNoteEliminationComplete);
 
-#ifdef ENABLE_VOICE
-    DECREMENT_AND_TRIGGER(gCountdownToPlayNextVoice_10ms, gFlagPlayQueuedVoice);
-#endif
-
 #ifdef ENABLE_FMRADIO
     if (gFM_ScanState != FM_SCAN_OFF && gCurrentFunction != FUNCTION_MONITOR)
         if (gCurrentFunction != FUNCTION_TRANSMIT && gCurrentFunction != FUNCTION_RECEIVE)
@@ -29,5 +29,9 @@ static void inline SCHEDULER_Disable()
 }
 
 uint32_t SYSTICK_GetTick(void);
+#ifdef ENABLE_STOP_MODE
+// Returns the 500 ms slices that will not get an APP_TimeSlice500ms() call
+uint16_t SCHEDULER_CatchUp(uint16_t Ticks);
+#endif
 
 #endif
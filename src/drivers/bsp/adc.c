@@ -3,12 +3,186 @@
 #include "drivers/hal/Inc/py32f071_ll_bus.h"
 #include "drivers/hal/Inc/py32f071_ll_gpio.h"
 #include "drivers/hal/Inc/py32f071_ll_rcc.h"
+#ifdef ENABLE_ADC_DMA
+    #include "drivers/hal/Inc/py32f071_ll_dma.h"
+    #include "drivers/hal/Inc/py32f071_ll_system.h"
+    #include "drivers/hal/Inc/py32f071_ll_tim.h"
+    #include "drivers/bsp/systick.h"
+#endif
 
 // Temperature Calibration Addresses (from factory)
 #define TS_CAL1_ADDR  ((uint16_t*)0x1FFF3228)  // 30 C 
 #define TS_CAL2_ADDR  ((uint16_t*)0x1FFF3230)  // 105 C
 #define VREFINT_MV    1200                     // Typical 1.2V
 
+#ifdef ENABLE_ADC_DMA
+// TIM15 starts a scan of all slots every 4 ms, DMA channel 1 stores the
+// conversions into a circular buffer. Every half buffer is summed up in the
+// DMA interrupt, each pair of halves makes one result per slot of 16 samples,
+// that is ADC_OVERSAMPLE_BITS more bits, every 64 ms.
+
+#define TIMx          TIM15
+#define DMA_CHANNEL   LL_DMA_CHANNEL_1
+#define SCAN_HZ       250U
+#define HALF_SCANS    8U
+#define RESULT_HALVES ((1U << (2 * ADC_OVERSAMPLE_BITS)) / HALF_SCANS)
+
+static const uint32_t Slots[] = {
+    LL_ADC_CHANNEL_8,            // battery divider, PB0
+    LL_ADC_CHANNEL_VREFINT,
+    LL_ADC_CHANNEL_TEMPSENSOR,
+    LL_ADC_CHANNEL_1_3VCCA,      // TRNG noise source
+};
+
+#define SLOT_COUNT (sizeof(Slots) / sizeof(Slots[0]))
+
+static uint16_t          ScanBuf[2 * HALF_SCANS][SLOT_COUNT];
+static uint32_t          Sums[SLOT_COUNT];
+static uint8_t           Halves;
+static volatile uint16_t Results[SLOT_COUNT];
+
+static int8_t FindSlot(uint32_t channel)
+{
+    for (uint8_t i = 0; i < SLOT_COUNT; i++) {
+        if (Slots[i] == channel)
+            return i;
+    }
+    return -1;
+}
+#endif
+
+// One blocking conversion of a single channel
+static uint16_t ConvertOnce(uint32_t channel)
+{
+    // Configure channel
+    LL_ADC_REG_SetSequencerRanks(ADC1, LL_ADC_REG_RANK_1, channel);
+
+    // Set sampling time (long enough for internal sensors)
+    LL_ADC_SetChannelSamplingTime(ADC1, channel, LL_ADC_SAMPLINGTIME_239CYCLES_5);
+
+    // Enable internal paths if needed
+    if (channel == LL_ADC_CHANNEL_TEMPSENSOR) {
+        LL_ADC_SetCommonPathInternalCh(ADC1_COMMON, LL_ADC_PATH_INTERNAL_TEMPSENSOR);
+    } else if (channel == LL_ADC_CHANNEL_VREFINT) {
+        LL_ADC_SetCommonPathInternalCh(ADC1_COMMON, LL_ADC_PATH_INTERNAL_VREFINT);
+    }
+
+    ADC_Start();
+
+    // Poll for EOS (approx 2ms timeout)
+    for (int i = 0; i < 10000; i++) {
+        if (LL_ADC_IsActiveFlag_EOS(ADC1)) {
+            uint16_t res = LL_ADC_REG_ReadConversionData12(ADC1);
+            LL_ADC_ClearFlag_EOS(ADC1);
+            return res;
+        }
+    }
+
+    return 0;
+}
+
+#ifdef ENABLE_ADC_DMA
+// ADC side of the scan, left disabled
+static void ScanConfig(void)
+{
+    LL_ADC_Disable(ADC1);
+
+    LL_ADC_SetCommonPathInternalCh(ADC1_COMMON, LL_ADC_PATH_INTERNAL_TEMPSENSOR | LL_ADC_PATH_INTERNAL_VREFINT);
+    LL_ADC_SetSequencersScanMode(ADC1, LL_ADC_SEQ_SCAN_ENABLE);
+    LL_ADC_REG_SetSequencerLength(ADC1, LL_ADC_REG_SEQ_SCAN_ENABLE_4RANKS);
+    LL_ADC_REG_SetSequencerRanks(ADC1, LL_ADC_REG_RANK_1, Slots[0]);
+    LL_ADC_REG_SetSequencerRanks(ADC1, LL_ADC_REG_RANK_2, Slots[1]);
+    LL_ADC_REG_SetSequencerRanks(ADC1, LL_ADC_REG_RANK_3, Slots[2]);
+    LL_ADC_REG_SetSequencerRanks(ADC1, LL_ADC_REG_RANK_4, Slots[3]);
+    for (uint8_t i = 0; i < SLOT_COUNT; i++)
+        LL_ADC_SetChannelSamplingTime(ADC1, Slots[i], LL_ADC_SAMPLINGTIME_239CYCLES_5);
+
+    LL_ADC_REG_SetTriggerSource(ADC1, LL_ADC_REG_TRIG_EXT_TIM15_TRGO);
+    LL_ADC_REG_SetDMATransfer(ADC1, LL_ADC_REG_DMA_TRANSFER_UNLIMITED);
+}
+
+static void ScanInit(void)
+{
+    // seed the results, the first scan only completes 64 ms from now
+    for (uint8_t i = 0; i < SLOT_COUNT; i++)
+        Results[i] = ConvertOnce(Slots[i]) << ADC_OVERSAMPLE_BITS;
+
+    ScanConfig();
+
+    // DMA
+    LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA1);
+    LL_APB1_GRP2_EnableClock(LL_APB1_GRP2_PERIPH_SYSCFG);
+
+    LL_SYSCFG_SetDMARemap(DMA1, DMA_CHANNEL, LL_SYSCFG_DMA_MAP_ADC1);
+
+    LL_DMA_InitTypeDef InitStruct;
+    InitStruct.PeriphOrM2MSrcAddress = LL_ADC_DMA_GetRegAddr(ADC1, LL_ADC_DMA_REG_REGULAR_DATA);
+    InitStruct.MemoryOrM2MDstAddress = (uint32_t)ScanBuf;
+    InitStruct.Direction = LL_DMA_DIRECTION_PERIPH_TO_MEMORY;
+    InitStruct.Mode = LL_DMA_MODE_CIRCULAR;
+    InitStruct.PeriphOrM2MSrcIncMode = LL_DMA_PERIPH_NOINCREMENT;
+    InitStruct.MemoryOrM2MDstIncMode = LL_DMA_MEMORY_INCREMENT;
+    InitStruct.PeriphOrM2MSrcDataSize = LL_DMA_PDATAALIGN_HALFWORD;
+    InitStruct.MemoryOrM2MDstDataSize = LL_DMA_MDATAALIGN_HALFWORD;
+    InitStruct.NbData = sizeof(ScanBuf) / sizeof(uint16_t);
+    InitStruct.Priority = LL_DMA_PRIORITY_LOW;
+    LL_DMA_Init(DMA1, DMA_CHANNEL, &InitStruct);
+
+    LL_DMA_EnableIT_HT(DMA1, DMA_CHANNEL);
+    LL_DMA_EnableIT_TC(DMA1, DMA_CHANNEL);
+    LL_DMA_EnableChannel(DMA1, DMA_CHANNEL);
+
+    NVIC_SetPriority(DMA1_Channel1_IRQn, 3);
+    NVIC_EnableIRQ(DMA1_Channel1_IRQn);
+
+    // TIM15: 48 MHz / 48000 = 1 kHz count
+    LL_APB1_GRP2_EnableClock(LL_APB1_GRP2_PERIPH_TIM15);
+    LL_TIM_SetPrescaler(TIMx, 47999);
+    LL_TIM_SetAutoReload(TIMx, 1000 / SCAN_HZ - 1);
+    LL_TIM_SetTriggerOutput(TIMx, LL_TIM_TRGO_UPDATE);
+
+    LL_ADC_Enable(ADC1);
+    LL_ADC_REG_StartConversionExtTrig(ADC1, LL_ADC_REG_TRIG_EXT_RISING);
+    LL_TIM_EnableCounter(TIMx);
+}
+
+void DMA1_Channel1_IRQHandler(void)
+{
+    const uint16_t (*pScan)[SLOT_COUNT];
+
+    if (LL_DMA_IsActiveFlag_HT1(DMA1)) {
+        LL_DMA_ClearFlag_HT1(DMA1);
+        pScan = ScanBuf;
+    } else if (LL_DMA_IsActiveFlag_TC1(DMA1)) {
+        LL_DMA_ClearFlag_TC1(DMA1);
+        pScan = ScanBuf + HALF_SCANS;
+    } else {
+        return;
+    }
+
+    for (uint8_t n = 0; n < HALF_SCANS; n++) {
+        for (uint8_t i = 0; i < SLOT_COUNT; i++)
+            Sums[i] += pScan[n][i];
+    }
+
+    if (++Halves < RESULT_HALVES)
+        return;
+
+    // 4^bits samples summed, shifting by bits keeps the extra resolution
+    for (uint8_t i = 0; i < SLOT_COUNT; i++) {
+        Results[i] = Sums[i] >> ADC_OVERSAMPLE_BITS;
+        Sums[i] = 0;
+    }
+    Halves = 0;
+}
+
+uint16_t ADC_ReadOversampled(uint32_t channel)
+{
+    const int8_t slot = FindSlot(channel);
+    return slot < 0 ? 0 : Results[slot];
+}
+#endif
+
 void ADC_Init(void)
 {
     LL_IOP_GRP1_EnableClock(LL_IOP_GRP1_PERIPH_GPIOB);
@@ -31,6 +205,10 @@ void ADC_Init(void)
     while (LL_ADC_IsCalibrationOnGoing(ADC1));
 
     LL_ADC_Enable(ADC1);
+
+#ifdef ENABLE_ADC_DMA
+    ScanInit();
+#endif
 }
 
 void ADC_Enable(void)
@@ -61,51 +239,85 @@ uint16_t ADC_GetValue(uint32_t channel)
     return LL_ADC_REG_ReadConversionData12(ADC1);
 }
 
+#ifdef ENABLE_ADC_DMA
+// Newest raw sample of a scanned channel, nothing waits for the ADC
 uint16_t ADC_ReadChannel(uint32_t channel)
 {
-    if (!(ADC1->CR2 & ADC_CR2_ADON)) {
-        ADC_Enable();
-    }
+    const int8_t slot = FindSlot(channel);
+    if (slot < 0)
+        return 0;
 
-    // Configure channel
-    LL_ADC_REG_SetSequencerRanks(ADC1, LL_ADC_REG_RANK_1, channel);
+    // the scan before the one the DMA is filling now is complete
+    const uint32_t written = sizeof(ScanBuf) / sizeof(uint16_t) - LL_DMA_GetDataLength(DMA1, DMA_CHANNEL);
+    const uint8_t  scan    = (written / SLOT_COUNT + 2 * HALF_SCANS - 1) % (2 * HALF_SCANS);
 
-    // Set sampling time (long enough for internal sensors)
-    LL_ADC_SetChannelSamplingTime(ADC1, channel, LL_ADC_SAMPLINGTIME_239CYCLES_5);
+    return ScanBuf[scan][slot];
+}
 
-    // Enable internal paths if needed
-    if (channel == LL_ADC_CHANNEL_TEMPSENSOR) {
-        LL_ADC_SetCommonPathInternalCh(ADC1_COMMON, LL_ADC_PATH_INTERNAL_TEMPSENSOR);
-    } else if (channel == LL_ADC_CHANNEL_VREFINT) {
-        LL_ADC_SetCommonPathInternalCh(ADC1_COMMON, LL_ADC_PATH_INTERNAL_VREFINT);
-    }
+// A fresh conversion: the scan is held for it, which keeps the DMA
+// buffer aligned to the slots
+uint16_t ADC_ReadChannelRaw(uint32_t channel)
+{
+    LL_TIM_DisableCounter(TIMx);
 
-    ADC_Start();
+    // a scan triggered just before is four conversions of ~21 us
+    SYSTICK_DelayUs(100);
+    while (LL_DMA_GetDataLength(DMA1, DMA_CHANNEL) % SLOT_COUNT) {}
 
-    // Poll for EOS (approx 2ms timeout)
-    for (int i = 0; i < 10000; i++) {
-        if (LL_ADC_IsActiveFlag_EOS(ADC1)) {
-            uint16_t res = LL_ADC_REG_ReadConversionData12(ADC1);
-            LL_ADC_ClearFlag_EOS(ADC1);
-            return res;
-        }
+    LL_ADC_Disable(ADC1);
+    LL_ADC_REG_SetDMATransfer(ADC1, LL_ADC_REG_DMA_TRANSFER_NONE);
+    LL_ADC_REG_SetTriggerSource(ADC1, LL_ADC_REG_TRIG_SOFTWARE);
+    LL_ADC_SetSequencersScanMode(ADC1, LL_ADC_SEQ_SCAN_DISABLE);
+    LL_ADC_REG_SetSequencerLength(ADC1, LL_ADC_REG_SEQ_SCAN_DISABLE);
+    LL_ADC_ClearFlag_EOS(ADC1);
+    LL_ADC_Enable(ADC1);
+
+    const uint16_t value = ConvertOnce(channel);
+
+    ScanConfig();
+    LL_ADC_Enable(ADC1);
+    LL_ADC_REG_StartConversionExtTrig(ADC1, LL_ADC_REG_TRIG_EXT_RISING);
+    LL_TIM_EnableCounter(TIMx);
+
+    return value;
+}
+
+#define SENSOR_BITS        (12 + ADC_OVERSAMPLE_BITS)
+#define ReadSensor(ch)     ADC_ReadOversampled(ch)
+#else
+uint16_t ADC_ReadChannel(uint32_t channel)
+{
+    if (!(ADC1->CR2 & ADC_CR2_ADON)) {
+        ADC_Enable();
     }
 
-    return 0;
+    return ConvertOnce(channel);
 }
 
+uint16_t ADC_ReadChannelRaw(uint32_t channel)
+{
+    return ADC_ReadChannel(channel);
+}
+
+#define SENSOR_BITS        12
+#define ReadSensor(ch)     ADC_ReadChannel(ch)
+#endif
+
+#define SENSOR_FULL_SCALE  ((1UL << SENSOR_BITS) - 1)
+
 uint16_t ADC_GetVref(void)
 {
-    uint16_t v_raw = ADC_ReadChannel(LL_ADC_CHANNEL_VREFINT);
+    uint16_t v_raw = ReadSensor(LL_ADC_CHANNEL_VREFINT);
     if (v_raw == 0) return 3300; 
-    return (uint16_t)(((uint32_t)VREFINT_MV * 4095) / (uint32_t)v_raw);
+    return (uint16_t)(((uint32_t)VREFINT_MV * SENSOR_FULL_SCALE) / (uint32_t)v_raw);
 }
 
 int16_t ADC_GetTemp(void)
 {
-    uint16_t ts_cal1 = *TS_CAL1_ADDR; // ADC raw value at 30 C
-    uint16_t ts_cal2 = *TS_CAL2_ADDR; // ADC raw value at 105 C
-    uint16_t ts_data = ADC_ReadChannel(LL_ADC_CHANNEL_TEMPSENSOR);
+    // calibration values are 12 bit readings
+    uint32_t ts_cal1 = (uint32_t)*TS_CAL1_ADDR << (SENSOR_BITS - 12); // ADC raw value at 30 C
+    uint32_t ts_cal2 = (uint32_t)*TS_CAL2_ADDR << (SENSOR_BITS - 12); // ADC raw value at 105 C
+    uint16_t ts_data = ReadSensor(LL_ADC_CHANNEL_TEMPSENSOR);
     uint16_t vdda_mv = ADC_GetVref();
     
     // TSCAL values are measured at 3.3V (3300mV). 
@@ -113,11 +325,11 @@ int16_t ADC_GetTemp(void)
     uint32_t ts_data_norm = ((uint32_t)ts_data * vdda_mv) / 3300;
 
     // Safety check for unprogrammed/corrupt calibration
-    if (ts_cal2 <= ts_cal1 || ts_cal1 == 0xFFFF || ts_cal1 == 0) {
+    if (ts_cal2 <= ts_cal1 || *TS_CAL1_ADDR == 0xFFFF || ts_cal1 == 0) {
         // Fallback to typical values: 0.75V at 30C, 2.5mV/C
-        // Voltage in mV: (ts_data_norm * 3300 / 4095)
+        // Voltage in mV: (ts_data_norm * 3300 / full scale)
         // Temp * 10 = 300 + (mV - 750) * 10 / 2.5
-        uint32_t mv = (ts_data_norm * 3300) / 4095;
+        uint32_t mv = (ts_data_norm * 3300) / SENSOR_FULL_SCALE;
         return 300 + ((int32_t)mv - 750) * 4; 
     }
 
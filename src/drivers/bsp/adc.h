@@ -13,8 +13,19 @@ void ADC_Start(void);
 void ADC_SoftReset(void);
 
 uint16_t ADC_ReadChannel(uint32_t channel);
+uint16_t ADC_ReadChannelRaw(uint32_t channel); // always converts, for noise sampling
 uint16_t ADC_GetValue(uint32_t channel);
 
+#ifdef ENABLE_ADC_DMA
+#define ADC_OVERSAMPLE_BITS 2
+
+/**
+ * @brief Latest oversampled reading of a scanned channel (battery, VREFINT,
+ *        temperature, 1/3 VCCA), 12 + ADC_OVERSAMPLE_BITS bits, never blocks
+ */
+uint16_t ADC_ReadOversampled(uint32_t channel);
+#endif
+
 /* --- Specialized Measurement functions --- */
 
 /**
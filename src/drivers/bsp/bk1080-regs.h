@@ -26,11 +26,22 @@ enum BK1080_Register_t {
     BK1080_REG_06_SYSTEM_CONFIGURATION3 = 0x06U,
     BK1080_REG_07                       = 0x07U,
     BK1080_REG_10                       = 0x0AU,
+    BK1080_REG_11                       = 0x0BU,
     BK1080_REG_25_INTERNAL              = 0x19U,
 };
 
 typedef enum BK1080_Register_t BK1080_Register_t;
 
+// REG 02
+
+#define BK1080_REG_02_SHIFT_SEEK        8
+#define BK1080_REG_02_SHIFT_SEEKUP      9
+#define BK1080_REG_02_SHIFT_SKMODE      10
+
+#define BK1080_REG_02_MASK_SEEK         (0x01U << BK1080_REG_02_SHIFT_SEEK)
+#define BK1080_REG_02_MASK_SEEKUP       (0x01U << BK1080_REG_02_SHIFT_SEEKUP)
+#define BK1080_REG_02_MASK_SKMODE       (0x01U << BK1080_REG_02_SHIFT_SKMODE)
+
 // REG 07
 
 #define BK1080_REG_07_SHIFT_FREQD       4
@@ -45,11 +56,15 @@ typedef enum BK1080_Register_t BK1080_Register_t;
 #define BK1080_REG_10_SHIFT_ST          8
 #define BK1080_REG_10_SHIFT_STEN        9
 #define BK1080_REG_10_SHIFT_AFCRL       12
+#define BK1080_REG_10_SHIFT_SFBL        13
+#define BK1080_REG_10_SHIFT_STC         14
 #define BK1080_REG_10_SHIFT_RSSI        0
 
 #define BK1080_REG_10_MASK_ST           (0x01U << BK1080_REG_10_SHIFT_ST)
 #define BK1080_REG_10_MASK_STEN         (0x01U << BK1080_REG_10_SHIFT_STEN)
 #define BK1080_REG_10_MASK_AFCRL        (0x01U << BK1080_REG_10_SHIFT_AFCRL)
+#define BK1080_REG_10_MASK_SFBL         (0x01U << BK1080_REG_10_SHIFT_SFBL)
+#define BK1080_REG_10_MASK_STC          (0x01U << BK1080_REG_10_SHIFT_STC)
 #define BK1080_REG_10_MASK_RSSI         (0xFFU << BK1080_REG_10_SHIFT_RSSI)
 
 #define BK1080_REG_10_AFCRL_NOT_RAILED      (0U << BK1080_REG_10_SHIFT_AFCRL)
@@ -59,5 +74,9 @@ typedef enum BK1080_Register_t BK1080_Register_t;
 #define BK1080_REG_10_GET_ST(x)         (((x) & BK1080_REG_10_MASK_ST) >> BK1080_REG_10_SHIFT_ST)
 #define BK1080_REG_10_GET_STEN(x)       (((x) & BK1080_REG_10_MASK_STEN) >> BK1080_REG_10_SHIFT_STEN)
 
+// REG 11
+
+#define BK1080_REG_11_MASK_READCHAN     0x03FFU
+
 #endif
 
@@ -132,6 +132,43 @@ void BK1080_SetFrequency(uint16_t frequency, uint8_t band, uint8_t spacing)
     BK1080_WriteRegister(BK1080_REG_03_CHANNEL, channel | 0x8000); // TUNE
 }
 
+void BK1080_StartSeek(void)
+{
+    // drop TUNE, otherwise STC still reports the tune
+    const uint16_t channel = BK1080_ReadRegister(BK1080_REG_03_CHANNEL);
+    BK1080_WriteRegister(BK1080_REG_03_CHANNEL, channel & ~0x8000u);
+
+    // upwards from the tuned channel, stop at the band edge instead of wrapping
+    uint16_t reg02 = BK1080_ReadRegister(BK1080_REG_02_POWER_CONFIGURATION);
+    reg02 |= BK1080_REG_02_MASK_SEEK | BK1080_REG_02_MASK_SEEKUP | BK1080_REG_02_MASK_SKMODE;
+    BK1080_WriteRegister(BK1080_REG_02_POWER_CONFIGURATION, reg02);
+}
+
+void BK1080_StopSeek(void)
+{
+    // clearing SEEK also clears STC for the next seek
+    const uint16_t reg02 = BK1080_ReadRegister(BK1080_REG_02_POWER_CONFIGURATION);
+    BK1080_WriteRegister(BK1080_REG_02_POWER_CONFIGURATION, reg02 & ~BK1080_REG_02_MASK_SEEK);
+}
+
+BK1080_SeekResult_t BK1080_PollSeek(uint16_t *pFrequency)
+{
+    static const uint16_t band_lo[] = {8750, 7600, 7600, 6400};
+    static const uint8_t  spacing[] = {20, 10, 5, 5};
+
+    const uint16_t status = BK1080_ReadRegister(BK1080_REG_10);
+    if ((status & BK1080_REG_10_MASK_STC) == 0)
+        return BK1080_SEEK_BUSY;
+
+    const uint16_t reg05   = BK1080_ReadRegister(BK1080_REG_05_SYSTEM_CONFIGURATION2);
+    const uint16_t channel = BK1080_ReadRegister(BK1080_REG_11) & BK1080_REG_11_MASK_READCHAN;
+    *pFrequency = band_lo[(reg05 >> 6) & 3] + channel * spacing[(reg05 >> 4) & 3];
+
+    BK1080_StopSeek();
+
+    return (status & BK1080_REG_10_MASK_SFBL) ? BK1080_SEEK_BAND_END : BK1080_SEEK_FOUND;
+}
+
 void BK1080_GetFrequencyDeviation(uint16_t Frequency)
 {
     BK1080_BaseFrequency      = Frequency;
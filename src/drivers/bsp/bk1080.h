@@ -21,6 +21,12 @@
 #include <stdint.h>
 #include "drivers/bsp/bk1080-regs.h"
 
+typedef enum {
+    BK1080_SEEK_BUSY,
+    BK1080_SEEK_FOUND,
+    BK1080_SEEK_BAND_END,
+} BK1080_SeekResult_t;
+
 extern uint16_t BK1080_BaseFrequency;
 extern uint16_t BK1080_FrequencyDeviation;
 
@@ -42,6 +48,9 @@ void BK1080_SetSoftMute(uint8_t rate, uint8_t attenuation);
 void BK1080_SetVolume(uint8_t volume);
 void BK1080_SetSeekThresholds(uint8_t rssi_th, uint8_t snr_th);
 void BK1080_SetFrequency(uint16_t frequency, uint8_t band, uint8_t spacing);
+void BK1080_StartSeek(void);
+void BK1080_StopSeek(void);
+BK1080_SeekResult_t BK1080_PollSeek(uint16_t *pFrequency);
 
 #endif
 
@@ -73,6 +73,17 @@ void     BK4819_SetRegValue(RegisterSpec s, uint16_t v);
 void     BK4819_WriteU8(uint8_t Data);
 void     BK4819_WriteU16(uint16_t Data);
 
+uint8_t  BK4819_CollectInterrupts(void);
+bool     BK4819_GetInterruptEvent(uint16_t *pEvent);
+#ifdef ENABLE_BK4819_IRQ
+void     BK4819_IRQ_Init(void);
+void     BK4819_IRQ_Handler(void);
+bool     BK4819_IRQ_Service(void);
+#endif
+#ifdef ENABLE_CW_ENGINE
+bool     BK4819_IsBusBusy(void);
+#endif
+
 void     BK4819_SetAGC(bool enable);
 void     BK4819_InitAGC(bool amModulation);
 void     BK4819_SetMicAGC(bool enable);
@@ -138,6 +149,8 @@ void     BK4819_PlayCDCSSTail(void);
 void     BK4819_PlayCTCSSTail(void);
 
 uint16_t BK4819_GetRSSI(void);
+uint16_t BK4819_GetRssiSettleUs(uint16_t Step_10Hz, BK4819_FilterBandwidth_t Bandwidth);
+uint16_t BK4819_AcquireRSSI(uint16_t SettleUs, uint8_t Samples);
 int8_t   BK4819_GetRxGain_dB(void);
 int16_t  BK4819_GetRSSI_dBm(void);
 uint8_t  BK4819_GetGlitchIndicator(void);
@@ -162,6 +175,9 @@ uint8_t  BK4819_GetCTCShift(void);
 uint8_t  BK4819_GetCTCType(void);
 
 void     BK4819_SendFSKData(uint16_t *pData);
+#ifdef ENABLE_AIRCOPY_V2
+    void     BK4819_SendFSKDataEx(const uint16_t *pData, uint8_t Words);
+#endif
 void     BK4819_PrepareFSKReceive(void);
 
 void     BK4819_PlayRoger(void);
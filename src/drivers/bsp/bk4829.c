@@ -29,6 +29,11 @@
 #include "drivers/bsp/system.h"
 #include "drivers/bsp/systick.h"
 
+#ifdef ENABLE_BK4819_IRQ
+    #include "py32f071_ll_bus.h"
+    #include "py32f071_ll_exti.h"
+#endif
+
 
 #ifndef ARRAY_SIZE
     #define ARRAY_SIZE(x) (sizeof(x) / sizeof(x[0]))
@@ -47,6 +52,35 @@ static uint16_t gBK4819_GpioOutState;
 
 bool gRxIdleMode;
 
+// Interrupt status words (REG_02) waiting to be handled. Single producer
+// (BK4819_CollectInterrupts), single consumer (BK4819_GetInterruptEvent).
+#define IRQ_RING_SIZE 16U
+
+static uint16_t          irqRing[IRQ_RING_SIZE];
+static volatile uint8_t  irqHead;
+static volatile uint8_t  irqTail;
+
+#ifdef ENABLE_BK4819_IRQ
+static volatile bool     irqPending;
+#endif
+
+#ifdef ENABLE_CW_ENGINE
+// Set while a register transfer is on the wire. The CW engine interrupt
+// checks it and leaves the bus alone until the next tick, so a transfer
+// started from thread context is never interleaved with its own.
+static volatile bool     busBusy;
+
+bool BK4819_IsBusBusy(void)
+{
+    return busBusy;
+}
+#define BUS_TAKE()       (busBusy = true)
+#define BUS_GIVE()       (busBusy = false)
+#else
+#define BUS_TAKE()
+#define BUS_GIVE()
+#endif
+
 static inline void CS_Assert()
 {
     GPIO_ResetOutputPin(PIN_CSN);
@@ -223,6 +257,7 @@ uint16_t BK4819_ReadRegister(BK4819_REGISTER_t Register)
 {
     uint16_t Value;
 
+    BUS_TAKE();
     CS_Release();
     SCL_Reset();
 
@@ -237,12 +272,14 @@ uint16_t BK4819_ReadRegister(BK4819_REGISTER_t Register)
 
     SCL_Set();
     SDA_Set();
+    BUS_GIVE();
 
     return Value;
 }
 
 void BK4819_WriteRegister(BK4819_REGISTER_t Register, uint16_t Data)
 {
+    BUS_TAKE();
     CS_Release();
     SCL_Reset();
 
@@ -263,8 +300,92 @@ void BK4819_WriteRegister(BK4819_REGISTER_t Register, uint16_t Data)
 
     SCL_Set();
     SDA_Set();
+    BUS_GIVE();
+}
+
+uint8_t BK4819_CollectInterrupts(void)
+{
+    uint8_t count = 0;
+
+    while (BK4819_ReadRegister(BK4819_REG_0C) & 1u) { // BK chip interrupt request
+        // clear interrupts, then fetch the status bits
+        BK4819_WriteRegister(BK4819_REG_02, 0);
+        const uint16_t events = BK4819_ReadRegister(BK4819_REG_02);
+        const uint8_t  head   = irqHead;
+        const uint8_t  next   = (head + 1) % IRQ_RING_SIZE;
+
+        if (next == irqTail) {
+            // full, fold into the newest word rather than lose a state change
+            irqRing[(head + IRQ_RING_SIZE - 1) % IRQ_RING_SIZE] |= events;
+        } else {
+            irqRing[head] = events;
+            irqHead = next;
+        }
+        count++;
+    }
+
+    return count;
+}
+
+bool BK4819_GetInterruptEvent(uint16_t *pEvent)
+{
+    const uint8_t tail = irqTail;
+
+    if (tail == irqHead)
+        return false;
+
+    *pEvent = irqRing[tail];
+    irqTail = (tail + 1) % IRQ_RING_SIZE;
+    return true;
 }
 
+#ifdef ENABLE_BK4819_IRQ
+void BK4819_IRQ_Init(void)
+{
+    LL_GPIO_InitTypeDef InitStruct;
+
+    LL_GPIO_StructInit(&InitStruct);
+    InitStruct.Pin  = GPIO_PIN_MASK(GPIO_PIN_BK4819_IRQ);
+    InitStruct.Mode = LL_GPIO_MODE_INPUT;
+    InitStruct.Pull = LL_GPIO_PULL_DOWN;
+    LL_GPIO_Init(GPIO_PORT(GPIO_PIN_BK4819_IRQ), &InitStruct);
+
+    LL_APB1_GRP2_EnableClock(LL_APB1_GRP2_PERIPH_SYSCFG);
+    LL_EXTI_SetEXTISource(LL_EXTI_CONFIG_PORTB, LL_EXTI_CONFIG_LINE7);
+    LL_EXTI_EnableRisingTrig(LL_EXTI_LINE_7);
+    LL_EXTI_ClearFlag(LL_EXTI_LINE_7);
+    LL_EXTI_EnableIT(LL_EXTI_LINE_7);
+
+    NVIC_SetPriority(EXTI4_15_IRQn, 2);
+    NVIC_EnableIRQ(EXTI4_15_IRQn);
+}
+
+// Nothing is read over the bus until the chip has raised its request line,
+// so an idle radio costs a GPIO read instead of a REG_0C transfer per tick.
+// The registers are not touched from the handler itself: the bus is
+// bit-banged from thread context, and code such as the FSK transmit path
+// polls REG_0C/REG_02 synchronously and must not have its request taken.
+bool BK4819_IRQ_Service(void)
+{
+    if (!irqPending && !GPIO_IsInputPinSet(GPIO_PIN_BK4819_IRQ))
+        return false;
+
+    irqPending = false;
+    BK4819_CollectInterrupts();
+
+    return true;
+}
+
+void BK4819_IRQ_Handler(void)
+{
+    if (!LL_EXTI_IsActiveFlag(LL_EXTI_LINE_7))
+        return;
+
+    LL_EXTI_ClearFlag(LL_EXTI_LINE_7);
+    irqPending = true;
+}
+#endif
+
 void BK4819_WriteU8(uint8_t Data)
 {
     unsigned int i;
@@ -1150,7 +1271,11 @@ void BK4819_TurnsOffTones_TurnsOnRX(void)
         BK4819_WriteRegister(BK4819_REG_58, 0x00C1);    // FSK Enable, FSK 1.2K RX Bandwidth, Preamble 0xAA or 0x55, RX Gain 0, RX Mode
                                                         // (FSK1.2K, FSK2.4K Rx and NOAA SAME Rx), TX Mode FSK 1.2K and FSK 2.4K Tx
         BK4819_WriteRegister(BK4819_REG_5C, 0x5665);    // Enable CRC among other things we don't know yet
+#ifdef ENABLE_AIRCOPY_V2
+        BK4819_WriteRegister(BK4819_REG_5D, 0x8700);    // FSK Data Length 136 Bytes (0xabcd + 2 byte header + 128 byte payload + 2 byte CRC + 0xdcba)
+#else
         BK4819_WriteRegister(BK4819_REG_5D, 0x4700);    // FSK Data Length 72 Bytes (0xabcd + 2 byte length + 64 byte payload + 2 byte CRC + 0xdcba)
+#endif
         BK4819_WriteRegister(0x5E, 0x3204);
     }
 #endif
@@ -1542,6 +1667,63 @@ uint16_t BK4819_GetRSSI(void)
     return BK4819_ReadRegister(BK4819_REG_67) & 0x01FF;
 }
 
+// Upper bound on the time BK4819_AcquireRSSI may spend waiting for the
+// glitch indicator to become valid, and the polling interval used meanwhile.
+#define RSSI_TIMEOUT_US     3000
+#define RSSI_POLL_US         100
+// spacing between samples when averaging
+#define RSSI_SAMPLE_US        50
+
+uint16_t BK4819_GetRssiSettleUs(uint16_t Step_10Hz, BK4819_FilterBandwidth_t Bandwidth)
+{
+    // PLL re-lock time grows with the size of the hop, the IF filter and
+    // AGC need longer to settle the narrower the filter is
+    uint16_t pll_us = 250;
+    if (Step_10Hz > 2500)
+        pll_us += (Step_10Hz - 2500) / 20;
+    if (pll_us > 750)
+        pll_us = 750;
+
+    uint16_t filter_us;
+    switch (Bandwidth)
+    {
+        case BK4819_FILTER_BW_WIDE:     filter_us = 150; break;
+        case BK4819_FILTER_BW_NARROW:   filter_us = 300; break;
+        case BK4819_FILTER_BW_AM:       filter_us = 450; break;
+        default:                        filter_us = 600; break;
+    }
+
+    return pll_us + filter_us;
+}
+
+uint16_t BK4819_AcquireRSSI(uint16_t SettleUs, uint8_t Samples)
+{
+    uint32_t waited = SettleUs;
+    uint32_t sum    = 0;
+
+    if (SettleUs)
+        SYSTICK_DelayUs(SettleUs);
+
+    // glitch indicator reads 0xFF until the demodulator has valid data
+    while (BK4819_GetGlitchIndicator() >= 255 && waited < RSSI_TIMEOUT_US)
+    {
+        SYSTICK_DelayUs(RSSI_POLL_US);
+        waited += RSSI_POLL_US;
+    }
+
+    if (Samples == 0)
+        Samples = 1;
+
+    for (uint8_t i = 0; i < Samples; i++)
+    {
+        if (i)
+            SYSTICK_DelayUs(RSSI_SAMPLE_US);
+        sum += BK4819_GetRSSI();
+    }
+
+    return sum / Samples;
+}
+
 uint8_t  BK4819_GetGlitchIndicator(void)
 {
     return BK4819_ReadRegister(BK4819_REG_63) & 0x00FF;
@@ -1754,6 +1936,57 @@ void BK4819_SendFSKData(uint16_t *pData)
     BK4819_ResetFSK();
 }
 
+#ifdef ENABLE_AIRCOPY_V2
+// Frames longer than the FIFO: the first 36 words go in up front like in
+// BK4819_SendFSKData, the rest is topped up from the almost-empty interrupt
+// while the frame is on air. Top-ups are kept small so the FIFO never holds
+// more than the prefill did.
+#define FSK_FIFO_PREFILL    36U
+#define FSK_FIFO_TOPUP      8U
+
+void BK4819_SendFSKDataEx(const uint16_t *pData, uint8_t Words)
+{
+    unsigned int i;
+    uint16_t Timeout = 2000;
+
+    SYSTEM_DelayMs(30);
+
+    BK4819_WriteRegister(BK4819_REG_3F, BK4819_REG_3F_FSK_TX_FINISHED | BK4819_REG_3F_FSK_FIFO_ALMOST_EMPTY);
+    BK4819_WriteRegister(BK4819_REG_59, 0x8068);
+    BK4819_WriteRegister(BK4819_REG_59, 0x0068);
+
+    for (i = 0; i < Words && i < FSK_FIFO_PREFILL; i++)
+        BK4819_WriteRegister(BK4819_REG_5F, pData[i]);
+
+    SYSTEM_DelayMs(20);
+
+    BK4819_WriteRegister(BK4819_REG_59, 0x2868);
+
+    while (Timeout--) {
+        if ((BK4819_ReadRegister(BK4819_REG_0C) & 1u) == 0) {
+            SYSTEM_DelayMs(1);
+            continue;
+        }
+
+        BK4819_WriteRegister(BK4819_REG_02, 0);
+        const uint16_t Status = BK4819_ReadRegister(BK4819_REG_02);
+
+        if (Status & BK4819_REG_02_FSK_TX_FINISHED)
+            break;
+
+        if (Status & BK4819_REG_02_FSK_FIFO_ALMOST_EMPTY)
+            for (unsigned int j = 0; j < FSK_FIFO_TOPUP && i < Words; j++)
+                BK4819_WriteRegister(BK4819_REG_5F, pData[i++]);
+    }
+
+    BK4819_WriteRegister(BK4819_REG_02, 0);
+
+    SYSTEM_DelayMs(30);
+
+    BK4819_ResetFSK();
+}
+#endif
+
 void BK4819_PrepareFSKReceive(void)
 {
     BK4819_ResetFSK();
@@ -0,0 +1,59 @@
+/* Copyright 2025 deltafw
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include "drivers/bsp/cw_timer.h"
+#include "features/cw/cw.h"
+#include "py32f071_ll_bus.h"
+#include "py32f071_ll_tim.h"
+
+#define TIMx TIM14
+
+void CW_TIMER_Init(void)
+{
+    LL_APB1_GRP2_EnableClock(LL_APB1_GRP2_PERIPH_TIM14);
+
+    // Update freq = 48 MHz / 48 / 1000 == 1 KHz
+    LL_TIM_SetPrescaler(TIMx, 47);
+    LL_TIM_SetAutoReload(TIMx, 999);
+    LL_TIM_GenerateEvent_UPDATE(TIMx);
+    LL_TIM_ClearFlag_UPDATE(TIMx);
+    LL_TIM_EnableIT_UPDATE(TIMx);
+
+    NVIC_SetPriority(TIM14_IRQn, 3);
+    NVIC_EnableIRQ(TIM14_IRQn);
+}
+
+void CW_TIMER_Start(void)
+{
+    if (LL_TIM_IsEnabledCounter(TIMx))
+        return;
+
+    LL_TIM_SetCounter(TIMx, 0);
+    LL_TIM_EnableCounter(TIMx);
+}
+
+void CW_TIMER_Stop(void)
+{
+    LL_TIM_DisableCounter(TIMx);
+}
+
+void TIM14_IRQHandler(void)
+{
+    if (!LL_TIM_IsActiveFlag_UPDATE(TIMx))
+        return;
+
+    LL_TIM_ClearFlag_UPDATE(TIMx);
+    CW_EngineTick();
+}
@@ -0,0 +1,24 @@
+/* Copyright 2025 deltafw
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef DRIVER_CW_TIMER_H
+#define DRIVER_CW_TIMER_H
+
+// TIM14 update interrupt at 1 kHz driving CW_EngineTick
+void CW_TIMER_Init(void);
+void CW_TIMER_Start(void);
+void CW_TIMER_Stop(void);
+
+#endif
@@ -14,5 +14,25 @@
  *     limitations under the License.
  */
 
+#include "drivers/bsp/bk4819.h"
+#include "drivers/bsp/gpio.h"
+#include "drivers/bsp/keyboard.h"
+#include "drivers/bsp/system.h"
 
-
+#if defined(ENABLE_BK4819_IRQ) || defined(ENABLE_KEYPAD_IRQ) || defined(ENABLE_STOP_MODE)
+// EXTI lines 4..15 share one vector: PB7 is the BK4819 request line,
+// PB15:12 the keypad rows, PB10 PTT. Each handler checks and clears its own
+// lines.
+void EXTI4_15_IRQHandler(void)
+{
+#ifdef ENABLE_BK4819_IRQ
+    BK4819_IRQ_Handler();
+#endif
+#ifdef ENABLE_KEYPAD_IRQ
+    KEYBOARD_IRQ_Handler();
+#endif
+#ifdef ENABLE_STOP_MODE
+    SYSTEM_WakeIRQ_Handler();
+#endif
+}
+#endif
@@ -21,6 +21,11 @@
 #include "drivers/bsp/systick.h"
 #include "drivers/bsp/i2c.h"
 #include "core/misc.h"
+#ifdef ENABLE_KEYPAD_IRQ
+    #include "core/scheduler.h"
+    #include "py32f071_ll_bus.h"
+    #include "py32f071_ll_exti.h"
+#endif
 
 KEY_Code_t gKeyReading0     = KEY_INVALID;
 KEY_Code_t gKeyReading1     = KEY_INVALID;
@@ -76,7 +81,29 @@ static const KEY_Code_t keyboard[5][4] = {
     }
 };
 
-KEY_Code_t KEYBOARD_Poll(void)
+#ifdef ENABLE_KEYPAD_IRQ
+// Idle, all columns are held low so that any key, the side keys included,
+// pulls its row down and raises EXTI. The matrix is only scanned from the
+// 10 ms tick after such an edge and for as long as a key stays down.
+
+#define KEY_QUEUE_SIZE   8U
+#define KEY_SETTLE_TICKS 1U     // 10 ms ticks between an edge and the first scan
+
+static KEY_Event_t         keyQueue[KEY_QUEUE_SIZE];
+static volatile uint8_t    keyHead;
+static volatile uint8_t    keyTail;
+
+static volatile KEY_Code_t keyState     = KEY_INVALID;
+static KEY_Code_t          keyCandidate = KEY_INVALID;
+static volatile uint8_t    settleTicks;
+
+static inline void columns_idle()
+{
+    GPIO_ResetOutputPin(PIN_COLS);
+}
+#endif
+
+static KEY_Code_t Scan(void)
 {
     KEY_Code_t Key = KEY_INVALID;
 
@@ -123,9 +150,122 @@ KEY_Code_t KEYBOARD_Poll(void)
             break;
     }
 
+#ifdef ENABLE_KEYPAD_IRQ
+    columns_idle();
+#endif
+
     return Key;
 }
 
+#ifdef ENABLE_KEYPAD_IRQ
+void KEYBOARD_Init(void)
+{
+    LL_APB1_GRP2_EnableClock(LL_APB1_GRP2_PERIPH_SYSCFG);
+
+    LL_EXTI_SetEXTISource(LL_EXTI_CONFIG_PORTB, LL_EXTI_CONFIG_LINE12);
+    LL_EXTI_SetEXTISource(LL_EXTI_CONFIG_PORTB, LL_EXTI_CONFIG_LINE13);
+    LL_EXTI_SetEXTISource(LL_EXTI_CONFIG_PORTB, LL_EXTI_CONFIG_LINE14);
+    LL_EXTI_SetEXTISource(LL_EXTI_CONFIG_PORTB, LL_EXTI_CONFIG_LINE15);
+
+    // rows are pulled up, a press is a falling edge. Releases need no edge,
+    // the tick keeps scanning while anything is down.
+    LL_EXTI_EnableFallingTrig(PIN_MASK_ROWS);
+
+    keyState     = Scan();
+    keyCandidate = keyState;
+    keyHead      = keyTail;
+
+    LL_EXTI_ClearFlag(PIN_MASK_ROWS);
+    LL_EXTI_EnableIT(PIN_MASK_ROWS);
+
+    NVIC_SetPriority(EXTI4_15_IRQn, 2);
+    NVIC_EnableIRQ(EXTI4_15_IRQn);
+}
+
+void KEYBOARD_IRQ_Handler(void)
+{
+    if (!LL_EXTI_ReadFlag(PIN_MASK_ROWS))
+        return;
+
+    LL_EXTI_ClearFlag(PIN_MASK_ROWS);
+
+    // contacts bounce for a few ms, look at the matrix once they settled
+    if (!settleTicks)
+        settleTicks = KEY_SETTLE_TICKS;
+}
+
+static void Push(KEY_Code_t Key)
+{
+    const uint8_t head = keyHead;
+    const uint8_t next = (head + 1) % KEY_QUEUE_SIZE;
+
+    if (next == keyTail) // full, the newest state wins
+        keyTail = (keyTail + 1) % KEY_QUEUE_SIZE;
+
+    keyQueue[head].Key  = Key;
+    keyQueue[head].Tick = SYSTICK_GetTick();
+    keyHead = next;
+}
+
+void KEYBOARD_Tick(void)
+{
+    if (settleTicks) {
+        if (--settleTicks)
+            return;
+    } else if (keyState == KEY_INVALID && keyCandidate == KEY_INVALID) {
+        return; // idle, nothing to look at until a row goes down
+    }
+
+    const KEY_Code_t Key = Scan();
+
+    // driving the columns for the scan makes the rows toggle too
+    LL_EXTI_ClearFlag(PIN_MASK_ROWS);
+
+    // a new state has to be seen on two scans in a row
+    if (Key != keyCandidate) {
+        keyCandidate = Key;
+        return;
+    }
+
+    if (Key != keyState) {
+        keyState = Key;
+        Push(Key);
+    }
+
+    // a press that landed while the columns were being driven left no edge
+    if (Key == KEY_INVALID && read_rows() != PIN_MASK_ROWS)
+        settleTicks = KEY_SETTLE_TICKS;
+}
+
+bool KEYBOARD_GetEvent(KEY_Event_t *pEvent)
+{
+    const uint8_t tail = keyTail;
+
+    if (tail == keyHead)
+        return false;
+
+    *pEvent = keyQueue[tail];
+    keyTail = (tail + 1) % KEY_QUEUE_SIZE;
+    return true;
+}
+
+bool KEYBOARD_IsIdle(void)
+{
+    return keyState == KEY_INVALID && keyCandidate == KEY_INVALID &&
+           !settleTicks && keyTail == keyHead;
+}
+
+KEY_Code_t KEYBOARD_Poll(void)
+{
+    return keyState;
+}
+#else
+KEY_Code_t KEYBOARD_Poll(void)
+{
+    return Scan();
+}
+#endif
+
 bool KEYBOARD_IsShortcut(void)
 {
     uint32_t reg;
@@ -155,6 +295,9 @@ bool KEYBOARD_IsShortcut(void)
     if (reg & PIN_MASK_ROW(3)) return false;
     
     GPIO_SetOutputPin(PIN_COLS); // Cleanup
+#ifdef ENABLE_KEYPAD_IRQ
+    columns_idle();
+#endif
     return true;
 }
 
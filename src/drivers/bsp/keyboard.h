@@ -45,6 +45,14 @@ enum KEY_Code_e {
 };
 typedef enum KEY_Code_e KEY_Code_t;
 
+#ifdef ENABLE_KEYPAD_IRQ
+// Debounced keypad state change, Key is KEY_INVALID once everything is released
+typedef struct {
+    KEY_Code_t Key;
+    uint32_t   Tick;    // SYSTICK_GetTick() when the change was confirmed
+} KEY_Event_t;
+#endif
+
 extern KEY_Code_t gKeyReading0;
 extern KEY_Code_t gKeyReading1;
 extern uint16_t   gDebounceCounter;
@@ -53,5 +61,13 @@ extern bool       gWasFKeyPressed;
 KEY_Code_t KEYBOARD_Poll(void);
 bool       KEYBOARD_IsShortcut(void);
 
+#ifdef ENABLE_KEYPAD_IRQ
+void       KEYBOARD_Init(void);
+void       KEYBOARD_IRQ_Handler(void);
+void       KEYBOARD_Tick(void);
+bool       KEYBOARD_GetEvent(KEY_Event_t *pEvent);
+bool       KEYBOARD_IsIdle(void);
+#endif
+
 #endif
 
@@ -43,6 +43,22 @@ static uint32_t SectorCacheAddr = 0x1000000;
 static uint32_t BlackHole[1];
 static volatile bool TC_Flag;
 
+#ifdef ENABLE_ASYNC_FLASH
+// Write-back: WriteBuffer only updates SectorCache and notes what has to go
+// to flash, PY25Q16_Poll() then erases and programs it one step at a time.
+// Writes landing on the cached sector before the job starts are merged into
+// it. Reads of that sector come from the cache, touching any other sector
+// finishes the job first.
+static struct
+{
+    bool Pending;  // SectorCache is newer than flash
+    bool Started;  // an erase or page program has been issued
+    bool Erase;
+    uint16_t From; // next byte of the sector to program
+    uint16_t To;
+} Job;
+#endif
+
 static inline void CS_Assert()
 {
     GPIO_ResetOutputPin(CS_PIN);
@@ -215,6 +231,8 @@ static void WriteAddr(uint32_t Addr);
 static uint8_t ReadStatusReg(uint32_t Which);
 static void WaitWIP();
 static void WriteEnable();
+static void EraseCmd(uint32_t Addr);
+static void ProgramCmd(uint32_t Addr, const uint8_t *Buf, uint32_t Size);
 static void SectorErase(uint32_t Addr);
 static void SectorProgram(uint32_t Addr, const uint8_t *Buf, uint32_t Size);
 static void PageProgram(uint32_t Addr, const uint8_t *Buf, uint32_t Size);
@@ -229,6 +247,27 @@ void PY25Q16_ReadBuffer(uint32_t Address, void *pBuffer, uint32_t Size)
 {
 #ifdef DEBUG
     printf("spi flash read: %06x %ld\n", Address, Size);
+#endif
+#ifdef ENABLE_ASYNC_FLASH
+    if (Job.Pending)
+    {
+        const uint32_t Offset = Address - SectorCacheAddr;
+
+        if (Address >= SectorCacheAddr && Offset + Size <= SECTOR_SIZE)
+        {
+            memcpy(pBuffer, SectorCache + Offset, Size);
+            return;
+        }
+
+        if (Address < SectorCacheAddr + SECTOR_SIZE && Address + Size > SectorCacheAddr)
+        {
+            PY25Q16_Flush(); // straddles the pending sector
+        }
+        else
+        {
+            WaitWIP(); // no reads while an erase or program runs
+        }
+    }
 #endif
     CS_Assert();
 
@@ -269,12 +308,21 @@ void PY25Q16_WriteBuffer(uint32_t Address, const void *pBuffer, uint32_t Size, b
 
         if (SecAddr != SectorCacheAddr)
         {
+#ifdef ENABLE_ASYNC_FLASH
+            PY25Q16_Flush();
+#endif
             PY25Q16_ReadBuffer(SecAddr, SectorCache, SECTOR_SIZE);
             SectorCacheAddr = SecAddr;
         }
 
         if (0 != memcmp(pBuffer, (char *)SectorCache + SecOffset, SecSize))
         {
+#ifdef ENABLE_ASYNC_FLASH
+            if (Job.Started)
+            {
+                PY25Q16_Flush(); // it is programming straight from the cache
+            }
+#endif
             bool Erase = false;
             for (uint32_t i = 0; i < SecSize; i++)
             {
@@ -287,6 +335,33 @@ void PY25Q16_WriteBuffer(uint32_t Address, const void *pBuffer, uint32_t Size, b
 
             memcpy(SectorCache + SecOffset, pBuffer, SecSize);
 
+#ifdef ENABLE_ASYNC_FLASH
+            // a queued program only ever fills 0xff bytes, so a byte that is
+            // 0xff in the cache is still 0xff in flash and Erase holds
+            if (Erase)
+            {
+                if (Append)
+                {
+                    memset(SectorCache + SecOffset + SecSize, 0xff, SECTOR_SIZE - SecOffset - SecSize);
+                }
+                Job.Erase = true;
+                Job.From = 0;
+                Job.To = SECTOR_SIZE;
+            }
+            else if (!Job.Pending)
+            {
+                Job.From = SecOffset;
+                Job.To = SecOffset + SecSize;
+            }
+            else
+            {
+                if (Job.From > SecOffset)
+                    Job.From = SecOffset;
+                if (Job.To < SecOffset + SecSize)
+                    Job.To = SecOffset + SecSize;
+            }
+            Job.Pending = true;
+#else
             if (Erase)
             {
                 SectorErase(SecAddr);
@@ -304,6 +379,7 @@ void PY25Q16_WriteBuffer(uint32_t Address, const void *pBuffer, uint32_t Size, b
             {
                 SectorProgram(Address, pBuffer, SecSize);
             }
+#endif
         }
 
         Address += SecSize;
@@ -316,16 +392,139 @@ void PY25Q16_WriteBuffer(uint32_t Address, const void *pBuffer, uint32_t Size, b
     } // while
 }
 
+uint8_t *PY25Q16_LoadSector(uint32_t Address)
+{
+    Address -= (Address % SECTOR_SIZE);
+#ifdef ENABLE_ASYNC_FLASH
+    // the caller edits the cache in place
+    if (Address != SectorCacheAddr || Job.Started)
+    {
+        PY25Q16_Flush();
+    }
+#endif
+    if (Address != SectorCacheAddr)
+    {
+        PY25Q16_ReadBuffer(Address, SectorCache, SECTOR_SIZE);
+        SectorCacheAddr = Address;
+    }
+    return SectorCache;
+}
+
+void PY25Q16_FlushSector(void)
+{
+#ifdef ENABLE_ASYNC_FLASH
+    Job.Erase = true;
+    Job.From = 0;
+    Job.To = SECTOR_SIZE;
+    Job.Pending = true;
+#else
+    SectorErase(SectorCacheAddr);
+    SectorProgram(SectorCacheAddr, SectorCache, SECTOR_SIZE);
+#endif
+}
+
 void PY25Q16_SectorErase(uint32_t Address)
 {
     Address -= (Address % SECTOR_SIZE);
+#ifdef ENABLE_ASYNC_FLASH
+    if (Address != SectorCacheAddr || Job.Started)
+    {
+        PY25Q16_Flush();
+    }
+    SectorCacheAddr = Address;
+    memset(SectorCache, 0xff, SECTOR_SIZE);
+    Job.Erase = true;
+    Job.From = 0;
+    Job.To = 0;
+    Job.Pending = true;
+#else
     SectorErase(Address);
     if (SectorCacheAddr == Address)
     {
         memset(SectorCache, 0xff, SECTOR_SIZE);
     }
+#endif
 }
 
+#ifdef ENABLE_ASYNC_FLASH
+static bool IsBlank(const uint8_t *Buf, uint32_t Size)
+{
+    for (uint32_t i = 0; i < Size; i++)
+    {
+        if (Buf[i] != 0xff)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void PY25Q16_Poll(void)
+{
+    if (!Job.Pending)
+    {
+        return;
+    }
+
+    if (Job.Started)
+    {
+        if (1 & ReadStatusReg(0)) // WIP
+        {
+            return;
+        }
+    }
+    else
+    {
+        Job.Started = true;
+        if (Job.Erase)
+        {
+            EraseCmd(SectorCacheAddr);
+            return;
+        }
+    }
+
+    while (Job.From < Job.To)
+    {
+        uint32_t Size = PAGE_SIZE - (Job.From % PAGE_SIZE);
+        if (Size > (uint32_t)(Job.To - Job.From))
+        {
+            Size = Job.To - Job.From;
+        }
+
+        const uint16_t From = Job.From;
+        Job.From += Size;
+
+        // programming 0xff changes nothing, erased or not
+        if (!IsBlank(SectorCache + From, Size))
+        {
+            ProgramCmd(SectorCacheAddr + From, SectorCache + From, Size);
+            return;
+        }
+    }
+
+    Job.Pending = false;
+    Job.Started = false;
+    Job.Erase = false;
+}
+
+void PY25Q16_Flush(void)
+{
+    while (Job.Pending)
+    {
+        PY25Q16_Poll();
+        if (Job.Pending)
+        {
+            SYSTICK_DelayUs(10);
+        }
+    }
+}
+
+bool PY25Q16_IsBusy(void)
+{
+    return Job.Pending;
+}
+#endif
+
 static inline void WriteAddr(uint32_t Addr)
 {
     SPI_WriteByte(0xff & (Addr >> 16));
@@ -380,7 +579,7 @@ static void WriteEnable()
     CS_Release();
 }
 
-static void SectorErase(uint32_t Addr)
+static void EraseCmd(uint32_t Addr)
 {
 #ifdef DEBUG
     printf("spi flash sector erase: %06x\n", Addr);
@@ -392,7 +591,11 @@ static void SectorErase(uint32_t Addr)
     SPI_WriteByte(0x20);
     WriteAddr(Addr);
     CS_Release();
+}
 
+static void SectorErase(uint32_t Addr)
+{
+    EraseCmd(Addr);
     WaitWIP();
 }
 
@@ -418,6 +621,12 @@ static void SectorProgram(uint32_t Addr, const uint8_t *Buf, uint32_t Size)
 }
 
 static void PageProgram(uint32_t Addr, const uint8_t *Buf, uint32_t Size)
+{
+    ProgramCmd(Addr, Buf, Size);
+    WaitWIP();
+}
+
+static void ProgramCmd(uint32_t Addr, const uint8_t *Buf, uint32_t Size)
 {
 #ifdef DEBUG
     printf("spi flash page program: %06x %ld\n", Addr, Size);
@@ -444,8 +653,6 @@ static void PageProgram(uint32_t Addr, const uint8_t *Buf, uint32_t Size)
     }
 
     CS_Release();
-
-    WaitWIP();
 }
 
 void DMA1_Channel4_5_6_7_IRQHandler()
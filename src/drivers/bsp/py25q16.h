@@ -24,5 +24,15 @@ void PY25Q16_Init();
 void PY25Q16_ReadBuffer(uint32_t Address, void *pBuffer, uint32_t Size);
 void PY25Q16_WriteBuffer(uint32_t Address, const void *pBuffer, uint32_t Size, bool Append);
 void PY25Q16_SectorErase(uint32_t Address);
+// Sector-wide rewrite: modify the cached copy returned by LoadSector in place,
+// then FlushSector erases and programs it in one pass
+uint8_t *PY25Q16_LoadSector(uint32_t Address);
+void PY25Q16_FlushSector(void);
+#ifdef ENABLE_ASYNC_FLASH
+// Writes are queued and carried out by Poll, one erase or page per call
+void PY25Q16_Poll(void);
+void PY25Q16_Flush(void);
+bool PY25Q16_IsBusy(void);
+#endif
 
 #endif
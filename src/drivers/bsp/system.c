@@ -16,6 +16,12 @@
 
 #include "drivers/bsp/system.h"
 #include "drivers/bsp/systick.h"
+#ifdef ENABLE_STOP_MODE
+    #include "py32f071_ll_bus.h"
+    #include "py32f071_ll_exti.h"
+    #include "py32f071_ll_lptim.h"
+    #include "py32f071_ll_rcc.h"
+#endif
 
 void SYSTEM_DelayMs(uint32_t Delay)
 {
@@ -25,3 +31,120 @@ void SYSTEM_DelayMs(uint32_t Delay)
 void SYSTEM_ConfigureClocks(void)
 {
 }
+
+#ifdef ENABLE_STOP_MODE
+// LPTIM1 runs from LSI / 32, one count is a little under a millisecond and
+// the 16 bit counter reaches a full minute.
+#define LPTIM_HZ        (LSI_VALUE / 32U)
+#define LPTIM_EXTI_LINE LL_EXTI_LINE_29
+#define PTT_EXTI_LINE   LL_EXTI_LINE_10     // PB10
+
+void SYSTEM_StopInit(void)
+{
+    LL_RCC_LSI_Enable();
+    while (!LL_RCC_LSI_IsReady())
+        ;
+
+    LL_RCC_SetLPTIMClockSource(LL_RCC_LPTIM1_CLKSOURCE_LSI);
+    LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_LPTIM1);
+
+    // CFGR and IER only take writes while the timer is disabled
+    LL_LPTIM_Disable(LPTIM1);
+    LL_LPTIM_SetPrescaler(LPTIM1, LL_LPTIM_PRESCALER_DIV32);
+    LL_LPTIM_SetUpdateMode(LPTIM1, LL_LPTIM_UPDATE_MODE_IMMEDIATE);
+    LL_LPTIM_EnableIT_ARRM(LPTIM1);
+    LL_EXTI_EnableIT(LPTIM_EXTI_LINE);
+
+    // the keypad rows and the BK4819 request line already wake the core
+    // through EXTI, PTT is polled and needs its own edge
+    LL_APB1_GRP2_EnableClock(LL_APB1_GRP2_PERIPH_SYSCFG);
+    LL_EXTI_SetEXTISource(LL_EXTI_CONFIG_PORTB, LL_EXTI_CONFIG_LINE10);
+    LL_EXTI_EnableFallingTrig(PTT_EXTI_LINE);
+    LL_EXTI_ClearFlag(PTT_EXTI_LINE);
+    LL_EXTI_EnableIT(PTT_EXTI_LINE);
+
+    NVIC_SetPriority(TIM6_LPTIM1_DAC_IRQn, 3);
+    NVIC_EnableIRQ(TIM6_LPTIM1_DAC_IRQn);
+    NVIC_SetPriority(EXTI4_15_IRQn, 2);
+    NVIC_EnableIRQ(EXTI4_15_IRQn);
+}
+
+// Stops the core for at most Ticks_10ms ticks, any enabled interrupt ends it
+// early. Call it with interrupts masked: the wake source is only serviced
+// once the caller unmasks them, after the clocks are back. Returns the whole
+// ticks that went by, SysTick did not count them.
+uint16_t SYSTEM_Stop(uint16_t Ticks_10ms)
+{
+    uint32_t counts = (uint32_t)Ticks_10ms * LPTIM_HZ / 100U;
+    uint32_t elapsed;
+
+    if (counts > 0xFFFFU)
+        counts = 0xFFFFU;
+
+    LL_LPTIM_Enable(LPTIM1);
+    LL_LPTIM_ClearFLAG_ARROK(LPTIM1);
+    LL_LPTIM_SetAutoReload(LPTIM1, counts);
+    while (!LL_LPTIM_IsActiveFlag_ARROK(LPTIM1))
+        ;
+    LL_LPTIM_StartCounter(LPTIM1, LL_LPTIM_OPERATING_MODE_ONESHOT);
+
+    // STOP turns HSE and the PLL off, note what has to come back
+    const uint32_t sysclk = LL_RCC_GetSysClkSource();
+    const uint32_t hse    = READ_BIT(RCC->CR, RCC_CR_HSEON);
+
+    // STOP1, core and PLL off, low power regulator
+    SET_BIT(PWR->CR1, PWR_CR1_LPR);
+    SET_BIT(SCB->SCR, SCB_SCR_SLEEPDEEP_Msk);
+    __WFI();
+    CLEAR_BIT(SCB->SCR, SCB_SCR_SLEEPDEEP_Msk);
+    CLEAR_BIT(PWR->CR1, PWR_CR1_LPR);
+
+    // the core wakes up on HSI, put back what the bootloader left running.
+    // HSE first, it may feed the PLL or be SYSCLK itself.
+    if (hse) {
+        LL_RCC_HSE_Enable();
+        while (!LL_RCC_HSE_IsReady())
+            ;
+    }
+
+    if (sysclk == LL_RCC_SYS_CLKSOURCE_STATUS_HSE) {
+        LL_RCC_SetSysClkSource(LL_RCC_SYS_CLKSOURCE_HSE);
+        while (LL_RCC_GetSysClkSource() != LL_RCC_SYS_CLKSOURCE_STATUS_HSE)
+            ;
+    } else if (sysclk == LL_RCC_SYS_CLKSOURCE_STATUS_PLL) {
+        LL_RCC_PLL_Enable();
+        while (!LL_RCC_PLL_IsReady())
+            ;
+        LL_RCC_SetSysClkSource(LL_RCC_SYS_CLKSOURCE_PLL);
+        while (LL_RCC_GetSysClkSource() != LL_RCC_SYS_CLKSOURCE_STATUS_PLL)
+            ;
+    }
+
+    if (LL_LPTIM_IsActiveFlag_ARRM(LPTIM1)) {
+        elapsed = counts;
+    } else {
+        // CNT is clocked from LSI, two equal reads make a good one
+        do {
+            elapsed = LL_LPTIM_GetCounter(LPTIM1);
+        } while (elapsed != LL_LPTIM_GetCounter(LPTIM1));
+    }
+
+    LL_LPTIM_Disable(LPTIM1);
+
+    return elapsed * 100U / LPTIM_HZ;
+}
+
+// EXTI4_15 is shared, only PB10 is ours
+void SYSTEM_WakeIRQ_Handler(void)
+{
+    if (LL_EXTI_ReadFlag(PTT_EXTI_LINE))
+        LL_EXTI_ClearFlag(PTT_EXTI_LINE);
+}
+
+void TIM6_LPTIM1_DAC_IRQHandler(void)
+{
+    if (LL_LPTIM_IsActiveFlag_ARRM(LPTIM1))
+        LL_LPTIM_ClearFLAG_ARRM(LPTIM1);
+    LL_EXTI_ClearFlag(LPTIM_EXTI_LINE);
+}
+#endif
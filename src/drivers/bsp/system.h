@@ -22,5 +22,11 @@
 void SYSTEM_DelayMs(uint32_t Delay);
 void SYSTEM_ConfigureClocks(void);
 
+#ifdef ENABLE_STOP_MODE
+void     SYSTEM_StopInit(void);
+uint16_t SYSTEM_Stop(uint16_t Ticks_10ms);
+void     SYSTEM_WakeIRQ_Handler(void);
+#endif
+
 #endif
 
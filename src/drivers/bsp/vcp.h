@@ -50,4 +50,9 @@ static inline void VCP_SendAsync(const uint8_t *Buf, uint32_t Size)
     cdc_acm_data_send_with_dtr_async(Buf, Size);
 }
 
+static inline bool VCP_IsTxBusy(void)
+{
+    return cdc_acm_tx_busy();
+}
+
 #endif // _DRIVER_VCP_H
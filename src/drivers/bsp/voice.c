@@ -89,39 +89,44 @@ void VOICE_Init()
     LL_DAC_EnableTrigger(DAC1, DAC_CHANNEL);
 }
 
-void VOICE_Start()
-{
-    LL_DAC_Enable(DAC1, DAC_CHANNEL);
-    LL_TIM_DisableCounter(TIMx);
+// Copies the next queued chunk into one half of the DAC ping-pong buffer.
+// Two silent halves in a row mean every queued sample has been played.
+static volatile uint8_t SilentHalves;
 
+static void FillHalf(uint16_t *pHalf)
+{
     if (gVoiceBufLen > 0)
     {
-        memcpy(DAC_Buf, gVoiceBuf[gVoiceBufReadIndex], VOICE_BUF_SIZE);
-        VOICE_BUF_ForwardReadIndex();
-        gVoiceBufLen--;
-    }
-    else
-    {
-        memset(DAC_Buf, 0, VOICE_BUF_SIZE);
-    }
-    if (gVoiceBufLen > 0)
-    {
-        memcpy(DAC_Buf + VOICE_BUF_SIZE,      //
-               gVoiceBuf[gVoiceBufReadIndex], //
-               VOICE_BUF_SIZE                 //
-        );
+        memcpy(pHalf, gVoiceBuf[gVoiceBufReadIndex], VOICE_BUF_SIZE);
         VOICE_BUF_ForwardReadIndex();
         gVoiceBufLen--;
+        SilentHalves = 0;
     }
     else
     {
-        memset(DAC_Buf + VOICE_BUF_SIZE, 0, VOICE_BUF_SIZE);
+        memset(pHalf, 0, VOICE_BUF_SIZE);
+        if (SilentHalves < 2)
+        {
+            SilentHalves++;
+        }
     }
+}
+
+void VOICE_Start()
+{
+    LL_DAC_Enable(DAC1, DAC_CHANNEL);
+    LL_TIM_DisableCounter(TIMx);
+    LL_DMA_DisableChannel(DMA1, DMA_CHANNEL);
 
-    LL_DMA_ConfigAddresses(DMA1, DMA_CHANNEL, DAC_Buf,                                                         //
+    SilentHalves = 0;
+    FillHalf(DAC_Buf);
+    FillHalf(DAC_Buf + VOICE_BUF_LEN);
+
+    LL_DMA_ConfigAddresses(DMA1, DMA_CHANNEL, (uint32_t)DAC_Buf,                                               //
                            LL_DAC_DMA_GetRegAddr(DAC1, DAC_CHANNEL, LL_DAC_DMA_REG_DATA_12BITS_RIGHT_ALIGNED), //
                            LL_DMA_DIRECTION_MEMORY_TO_PERIPH                                                   //
     );
+    LL_DMA_SetDataLength(DMA1, DMA_CHANNEL, VOICE_BUF_LEN * 2);
     LL_DMA_EnableChannel(DMA1, DMA_CHANNEL);
     LL_TIM_EnableCounter(TIMx);
 }
@@ -133,37 +138,21 @@ void VOICE_Stop()
     LL_DAC_Disable(DAC1, DAC_CHANNEL);
 }
 
+bool VOICE_IsIdle()
+{
+    return SilentHalves >= 2;
+}
+
 void DMA1_Channel2_3_IRQHandler()
 {
     if (LL_DMA_IsActiveFlag_HT3(DMA1))
     {
         LL_DMA_ClearFlag_HT3(DMA1);
-        if (gVoiceBufLen > 0)
-        {
-            memcpy(DAC_Buf, gVoiceBuf[gVoiceBufReadIndex], VOICE_BUF_SIZE);
-            VOICE_BUF_ForwardReadIndex();
-            gVoiceBufLen--;
-        }
-        else
-        {
-            memset(DAC_Buf, 0, VOICE_BUF_SIZE);
-        }
+        FillHalf(DAC_Buf);
     }
     if (LL_DMA_IsActiveFlag_TC3(DMA1))
     {
         LL_DMA_ClearFlag_TC3(DMA1);
-        if (gVoiceBufLen > 0)
-        {
-            memcpy(DAC_Buf + VOICE_BUF_SIZE,      //
-                   gVoiceBuf[gVoiceBufReadIndex], //
-                   VOICE_BUF_SIZE                 //
-            );
-            VOICE_BUF_ForwardReadIndex();
-            gVoiceBufLen--;
-        }
-        else
-        {
-            memset(DAC_Buf + VOICE_BUF_SIZE, 0, VOICE_BUF_SIZE);
-        }
+        FillHalf(DAC_Buf + VOICE_BUF_LEN);
     }
 }
@@ -17,6 +17,7 @@
 #define DRIVER_VOICE_H
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #define VOICE_BUF_CAP 4
 #define VOICE_BUF_LEN 160
@@ -24,7 +25,8 @@
 extern uint16_t gVoiceBuf[VOICE_BUF_CAP][VOICE_BUF_LEN];
 extern uint8_t gVoiceBufReadIndex;
 extern uint8_t gVoiceBufWriteIndex;
-extern uint8_t gVoiceBufLen;
+// Chunks queued for the DMA interrupt, which drains one per 20 ms half buffer
+extern volatile uint8_t gVoiceBufLen;
 
 static inline void VOICE_BUF_ForwardReadIndex()
 {
@@ -39,5 +41,7 @@ static inline void VOICE_BUF_ForwardWriteIndex()
 void VOICE_Init();
 void VOICE_Start();
 void VOICE_Stop();
+// True once the queue ran dry and the last queued samples left the DAC
+bool VOICE_IsIdle();
 
 #endif // DRIVER_VOICE_H
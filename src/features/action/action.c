@@ -415,6 +415,16 @@ static void ACTION_Scan_FM(bool bRestart)
 
     uint16_t freq;
 
+#ifdef ENABLE_FM_SEEK_SCAN
+    if (bRestart) {
+        FM_AutoScanStart();
+#ifdef ENABLE_VOICE
+        gAnotherVoiceID = VOICE_ID_SCANNING_BEGIN;
+#endif
+        return;
+    }
+#endif
+
     if (bRestart) {
         gFM_AutoScan = true;
         gFM_ChannelPosition = 0;
@@ -50,6 +50,15 @@
     #include "features/uart/uart.h"
     #include "core/scheduler.h"
 #endif
+#ifdef ENABLE_KEYPAD_IRQ
+    #include "core/scheduler.h"
+#endif
+#if defined(ENABLE_STOP_MODE) && defined(ENABLE_USB)
+    #include "drivers/bsp/vcp.h"
+#endif
+#ifdef ENABLE_ASYNC_FLASH
+    #include "drivers/bsp/py25q16.h"
+#endif
 #include "py32f0xx.h"
 #include "features/audio/audio.h"
 #include "core/board.h"
@@ -127,6 +136,9 @@
 #ifdef ENABLE_CW_KEYER
     #include "features/cw/cw.h"
 #endif
+#ifdef ENABLE_CW_ENGINE
+    #include "drivers/bsp/cw_timer.h"
+#endif
 
 static bool flagSaveVfo;
 static bool flagSaveSettings;
@@ -573,6 +585,11 @@ void APP_StartListening(FUNCTION_Type_t function)
 #endif
 
 #ifdef ENABLE_FMRADIO
+    #ifdef ENABLE_FM_DUAL_RX
+        if (FM_IsPlaying())
+            FM_Duck(true);
+        else
+    #endif
     if (gFmRadioMode)
         BK1080_Init0();
 #endif
@@ -723,14 +740,19 @@ static void DualwatchAlternate(void)
 
 static void CheckRadioInterrupts(void)
 {
+    uint16_t events;
+
     if (SCANNER_IsScanning())
         return;
 
-    while (BK4819_ReadRegister(BK4819_REG_0C) & 1u) { // BK chip interrupt request
-        // clear interrupts
-        BK4819_WriteRegister(BK4819_REG_02, 0);
-        // fetch interrupt status bits
+#ifdef ENABLE_BK4819_IRQ
+    // only touches the bus once EXTI has seen the request line go up
+    BK4819_IRQ_Service();
+#else
+    BK4819_CollectInterrupts();
+#endif
 
+    while (BK4819_GetInterruptEvent(&events)) { // queued REG_02 status words
         union {
             struct {
                 uint16_t __UNUSED : 1;
@@ -753,7 +775,7 @@ static void CheckRadioInterrupts(void)
             uint16_t __raw;
         } interrupts;
 
-        interrupts.__raw = BK4819_ReadRegister(BK4819_REG_02);
+        interrupts.__raw = events;
 
         // 0 = no phase shift
         // 1 = 120deg phase shift
@@ -781,15 +803,8 @@ static void CheckRadioInterrupts(void)
 
 #ifdef ENABLE_DTMF_CALLING
                     if (gRxVfo->DTMF_DECODING_ENABLE || gSetting_KILLED) {
-                        if (gDTMF_RX_index >= sizeof(gDTMF_RX) - 1) { // make room
-                            memmove(&gDTMF_RX[0], &gDTMF_RX[1], sizeof(gDTMF_RX) - 1);
-                            gDTMF_RX_index--;
-                        }
-                        gDTMF_RX[gDTMF_RX_index++] = c;
-                        gDTMF_RX[gDTMF_RX_index]   = 0;
-                        gDTMF_RX_timeout           = DTMF_RX_timeout_500ms;  // time till we delete it
-                        gDTMF_RX_pending           = true;
-                        
+                        DTMF_PushRX(c);
+
                         SYSTEM_DelayMs(3);//fix DTMF not reply@Yurisu
                         DTMF_HandleRequest();
                     }
@@ -860,9 +875,9 @@ static void CheckRadioInterrupts(void)
         if (interrupts.fskFifoAlmostFull &&
             gScreenToDisplay == DISPLAY_AIRCOPY &&
             gAircopyState == AIRCOPY_TRANSFER &&
-            gAirCopyIsSendMode == 0)
+            AIRCOPY_IsReceiving())
         {
-            for (unsigned int i = 0; i < 4; i++) {
+            for (unsigned int i = 0; i < 4 && gFSKWriteIndex < AIRCOPY_FRAME_WORDS; i++) {
                 g_FSK_Buffer[gFSKWriteIndex++] = BK4819_ReadRegister(BK4819_REG_5F);
             }
 
@@ -975,7 +990,14 @@ void APP_Update(void)
     if (gInAppUpdate) return;
     gInAppUpdate = true;
 
+#ifdef ENABLE_BK4819_IRQ
+    // the request line is cheap to check, no need to wait for the next tick
+    if (!gReducedService && (gCurrentFunction != FUNCTION_POWER_SAVE || !gRxIdleMode))
+        CheckRadioInterrupts();
+#endif
+
 #ifdef ENABLE_VOICE
+    AUDIO_VoiceService();
     if (gFlagPlayQueuedVoice) {
             AUDIO_PlayQueuedVoice();
             gFlagPlayQueuedVoice = false;
@@ -1150,7 +1172,7 @@ void APP_Update(void)
 #ifdef ENABLE_VOICE
         && gVoiceWriteIndex == 0
 #endif
-#ifdef ENABLE_FMRADIO
+#if defined(ENABLE_FMRADIO) && !defined(ENABLE_FM_DUAL_RX)
         && !gFmRadioMode
 #endif
 #ifdef ENABLE_DTMF_CALLING
@@ -1240,18 +1262,7 @@ void APP_Update(void)
         {   // dual watch mode off or scanning or rssi update request
             // go back to sleep
 
-#ifdef ENABLE_DEEP_SLEEP_MODE
-            if(gWakeUp)
-            {
-                gPowerSave_10ms = gEeprom.BATTERY_SAVE * 200; // deep sleep now indexed on BatSav
-            }
-            else
-            {
-                gPowerSave_10ms = gEeprom.BATTERY_SAVE * 10;
-            }
-#else
-            gPowerSave_10ms = gEeprom.BATTERY_SAVE * 10;
-#endif
+            gPowerSave_10ms = FUNCTION_GetSleep_10ms();
             gRxIdleMode     = true;
             goToSleep = false;
 
@@ -1290,6 +1301,9 @@ void APP_ProcessKeys(void)
     // -------------------- KEYS ------------------------
     // Scan hardware keys first to support Side Key PTT
     KEY_Code_t Key = KEYBOARD_Poll();
+#ifdef ENABLE_KEYPAD_IRQ
+    const KEY_Code_t Scanned = Key;
+#endif
 
 
 // -------------------- PTT ------------------------
@@ -1631,6 +1645,43 @@ void APP_ProcessKeys(void)
     // scan the hardware keys
     // KEY_Code_t Key = KEYBOARD_Poll(); // Moved up
 
+#ifdef ENABLE_KEYPAD_IRQ
+    // Presses and releases arrive debounced and in order from the keypad
+    // interrupt, only hold and repeat timing is left to this tick.
+    KEY_Event_t Event;
+    bool        bEvent = false;
+
+    while (KEYBOARD_GetEvent(&Event))
+    {
+        if (Event.Key == Scanned && Key != Scanned)
+            Event.Key = KEY_INVALID; // side key doing PTT duty
+
+        if (Event.Key == gKeyReading1)
+            continue;
+
+        if (gKeyReading1 != KEY_INVALID)
+            ProcessKey(gKeyReading1, false, gKeyBeingHeld); // released, or replaced without a release
+
+        gKeyReading0 = Event.Key;
+        gKeyReading1 = Event.Key;
+        gKeyBeingHeld = false;
+        gDebounceCounter = key_debounce_10ms + (SYSTICK_GetTick() - Event.Tick);
+        bEvent = true;
+
+        if (Event.Key != KEY_INVALID)
+        {
+            boot_counter_10ms = 0;   // cancel boot screen/beeps if any key pressed
+            ProcessKey(Event.Key, true, false);
+        }
+    }
+
+    Key = gKeyReading1;
+
+    if (bEvent || Key == KEY_INVALID)
+        return;
+
+    gDebounceCounter++;
+#else
     if (Key != KEY_INVALID) // any key pressed
         boot_counter_10ms = 0;   // cancel boot screen/beeps if any key pressed
 
@@ -1666,6 +1717,7 @@ void APP_ProcessKeys(void)
         gKeyBeingHeld = false;
         return;
     }
+#endif
 
     if (gDebounceCounter < key_repeat_delay_10ms || Key == KEY_INVALID) // the button is not held long enough for repeat yet, or not really pressed
         return;
@@ -1694,6 +1746,50 @@ void APP_ProcessKeys(void)
     }
 }
 
+#ifdef ENABLE_STOP_MODE
+// Between two RX windows the BK4819 sleeps until gPowerSave_10ms runs out.
+// When nothing else needs the tick, stop the core for that long instead of
+// spinning on SysTick. PTT, the keypad and the LPTIM end the stop.
+void APP_PowerSaveStop(void)
+{
+    if (gCurrentFunction != FUNCTION_POWER_SAVE || !gRxIdleMode || gPowerSaveCountdownExpired)
+        return;
+
+    if (gIsCharging                         // on the charger there is nothing to save
+        || gSerialConfigCountDown_500ms     // USART1 does not run in STOP
+        || BACKLIGHT_IsOn()                 // nor does the backlight PWM
+        || gPttIsPressed
+        || gKeyBeingHeld
+        || gUpdateDisplay
+        || gUpdateStatus
+#ifdef ENABLE_USB
+        || VCP_IsConnected()
+#endif
+#ifdef ENABLE_VOICE
+        || gVoiceWriteIndex != 0
+#endif
+#ifdef ENABLE_ASYNC_FLASH
+        || PY25Q16_IsBusy()                 // the main loop drives the flash job
+#endif
+    )
+        return;
+
+    uint16_t Skipped = 0;
+
+    __disable_irq();
+    // an edge or a tick may have come in since the checks above
+    if (!gNextTimeslice && gPowerSave_10ms > 1 && KEYBOARD_IsIdle() && !GPIO_IsPttPressed())
+        Skipped = SCHEDULER_CatchUp(SYSTEM_Stop(gPowerSave_10ms));
+    __enable_irq();
+
+#ifdef ENABLE_BATTERY_MODEL
+    // the coulomb count needs every slice of the stop, not just the one that runs
+    BATTERY_CatchUp(Skipped);
+#else
+    (void)Skipped;
+#endif
+}
+#endif
 
 void APP_TimeSlice10ms(void)
 {
@@ -1728,8 +1824,10 @@ void APP_TimeSlice10ms(void)
     if (gReducedService)
         return;
 
+#ifndef ENABLE_BK4819_IRQ
     if (gCurrentFunction != FUNCTION_POWER_SAVE || !gRxIdleMode)
         CheckRadioInterrupts();
+#endif
 
 #ifdef ENABLE_FMRADIO
     FM_CheckAutoMute();
@@ -1783,6 +1881,11 @@ void APP_TimeSlice10ms(void)
         gEeprom.VfoInfo[1].Modulation == MODULATION_CW) {
         CW_Tick10ms();
     }
+#ifdef ENABLE_CW_ENGINE
+    else {
+        CW_TIMER_Stop();
+    }
+#endif
 #endif
 
     // TextInput Blink Hook
@@ -1902,7 +2005,7 @@ void APP_TimeSlice10ms(void)
     SCANNER_TimeSlice10ms();
 
 #ifdef ENABLE_AIRCOPY
-    if (gScreenToDisplay == DISPLAY_AIRCOPY && gAircopyState == AIRCOPY_TRANSFER && gAirCopyIsSendMode == 1) {
+    if (gScreenToDisplay == DISPLAY_AIRCOPY && gAircopyState == AIRCOPY_TRANSFER) {
         if (!AIRCOPY_SendMessage()) {
             GUI_DisplayScreen();
         }
@@ -2081,6 +2184,9 @@ void APP_TimeSlice500ms(void)
 
         if (gBatteryCalibration[3] < gBatteryCurrentVoltage)
         {
+            #ifdef ENABLE_ASYNC_FLASH
+                PY25Q16_Flush();
+            #endif
             #ifdef ENABLE_OVERLAY
                 overlay_FLASH_RebootToBootloader();
             #else
@@ -32,6 +32,9 @@ void     APP_ProcessKeys(void);
 
 void     APP_TimeSlice10ms(void);
 void     APP_TimeSlice500ms(void);
+#ifdef ENABLE_STOP_MODE
+void     APP_PowerSaveStop(void);
+#endif
 
 #endif
 
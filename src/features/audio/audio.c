@@ -205,12 +205,11 @@ void AUDIO_PlayBeep(BEEP_Type_t Beep)
 uint16_t gVoiceBuf[VOICE_BUF_CAP][VOICE_BUF_LEN];
 uint8_t gVoiceBufReadIndex = 0;
 uint8_t gVoiceBufWriteIndex = 0;
-uint8_t gVoiceBufLen = 0;
+volatile uint8_t gVoiceBufLen = 0;
 
 VOICE_ID_t        gVoiceID[8];
 uint8_t           gVoiceReadIndex;
 uint8_t           gVoiceWriteIndex;
-volatile uint16_t gCountdownToPlayNextVoice_10ms;
 volatile bool     gFlagPlayQueuedVoice;
 VOICE_ID_t        gAnotherVoiceID = VOICE_ID_INVALID;
 
@@ -250,12 +249,63 @@ static const uint16_t VOICE_SAMPLES[256] =
     0x083b, 0x0839, 0x083f, 0x083d, 0x0833, 0x0831, 0x0837, 0x0835 //
 };
 
+// Prompt table entries with this bit set in Size hold 4-bit IMA-ADPCM
+// (low nibble first, predictor and step index start at 0) instead of the
+// 8-bit codes of VOICE_SAMPLES. toolchain/voice_packer.py builds them.
+#define VOICE_CLIP_ADPCM 0x80000000U
+
+static const int8_t ADPCM_INDEX[16] =
+{
+    -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+static const uint16_t ADPCM_STEP[89] =
+{
+        7,     8,     9,    10,    11,    12,    13,    14,    16,    17, //
+       19,    21,    23,    25,    28,    31,    34,    37,    41,    45, //
+       50,    55,    60,    66,    73,    80,    88,    97,   107,   118, //
+      130,   143,   157,   173,   190,   209,   230,   253,   279,   307, //
+      337,   371,   408,   449,   494,   544,   598,   658,   724,   796, //
+      876,   963,  1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066, //
+     2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358, //
+     5894,  6484,  7132,  7845,  8630,  9493, 10442, 11487, 12635, 13899, //
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767        //
+};
+
 static struct
 {
     uint32_t Addr; // This is now interpreted as offset for REC_VOICE_CLIP_DATA
     uint32_t Size;
+    bool     Adpcm;
+    int16_t  Predictor;
+    uint8_t  StepIndex;
 } VoiceClipState = {0};
 
+static uint16_t DecodeAdpcm(uint8_t Code)
+{
+    const int32_t Step = ADPCM_STEP[VoiceClipState.StepIndex];
+    int32_t Diff = Step >> 3;
+    if (Code & 4)
+        Diff += Step;
+    if (Code & 2)
+        Diff += Step >> 1;
+    if (Code & 1)
+        Diff += Step >> 2;
+
+    int32_t Predictor = VoiceClipState.Predictor + ((Code & 8) ? -Diff : Diff);
+    if (Predictor > 32767)
+        Predictor = 32767;
+    else if (Predictor < -32768)
+        Predictor = -32768;
+    VoiceClipState.Predictor = Predictor;
+
+    int32_t Index = VoiceClipState.StepIndex + ADPCM_INDEX[Code];
+    VoiceClipState.StepIndex = Index < 0 ? 0 : (Index > 88 ? 88 : Index);
+
+    // 16-bit signed to the 12-bit DAC range around its midpoint
+    return (uint16_t)((Predictor >> 4) + 0x800);
+}
+
 static bool LoadVoiceClip(uint8_t VoiceID)
 {
     if (VoiceID >= VOICE_ID_END)
@@ -270,71 +320,120 @@ static bool LoadVoiceClip(uint8_t VoiceID)
     } Info;
     Storage_ReadRecordIndexed(REC_VOICE_PROMPT_DATA, gEeprom.VOICE_PROMPT == VOICE_PROMPT_CHINESE ? 0 : 1, &Info, 8 * VoiceID, 8);
 
+    const bool Adpcm = (Info.Size & VOICE_CLIP_ADPCM) != 0;
+    Info.Size &= ~VOICE_CLIP_ADPCM;
+
     if (Info.Offset > 0x0b0000 || Info.Size > 0x019000)
     {
         return false;
     }
 
-    VoiceClipState.Addr = Info.Offset;
-    VoiceClipState.Size = Info.Size;
+    VoiceClipState.Addr      = Info.Offset;
+    VoiceClipState.Size      = Info.Size;
+    VoiceClipState.Adpcm     = Adpcm;
+    VoiceClipState.Predictor = 0;
+    VoiceClipState.StepIndex = 0;
     return true;
 }
 
-static inline uint32_t CalcDelay(uint32_t Size)
-{
-    return 2 * Size; // in ms!!
-}
+static bool gVoiceStreaming;
 
-static void LoadVoiceSamples()
+// Reads the next chunk of the clip straight into the free queue slot. The
+// coded bytes land at the end of the slot and are expanded forward in place,
+// so no scratch buffer is needed.
+static bool LoadVoiceSamples()
 {
     if (0 == VoiceClipState.Addr || 0 == VoiceClipState.Size)
     {
-        return;
+        return false;
     }
     if (gVoiceBufLen >= VOICE_BUF_CAP)
     {
-        return;
+        return false;
     }
 
-    extern uint8_t **gFrameBuffer;
-    uint8_t *Buf = (uint8_t *)gFrameBuffer;
-    Storage_ReadRecordIndexed(REC_VOICE_CLIP_DATA, VoiceClipState.Addr, Buf, 0, VOICE_BUF_LEN);
-    VoiceClipState.Addr += VOICE_BUF_LEN;
-    VoiceClipState.Size -= VOICE_BUF_LEN;
+    // one chunk is VOICE_BUF_LEN samples, two per byte for ADPCM
+    const uint32_t Bytes = VoiceClipState.Adpcm ? VOICE_BUF_LEN / 2 : VOICE_BUF_LEN;
+    uint16_t *Slot = gVoiceBuf[gVoiceBufWriteIndex];
+    uint8_t *Raw = (uint8_t *)Slot + sizeof(gVoiceBuf[0]) - Bytes;
+    uint32_t Len = VoiceClipState.Size < Bytes ? VoiceClipState.Size : Bytes;
+
+    // offsets run past what the 16-bit record index of REC_VOICE_CLIP_DATA reaches
+    Storage_ReadBufferRaw(Storage_GetAddress(REC_VOICE_CLIP_DATA, 0) + VoiceClipState.Addr, Raw, Len);
+    // pad the tail with silence: A-law zero, or ADPCM codes that cancel out
+    memset(Raw + Len, VoiceClipState.Adpcm ? 0x08 : 0xD5, Bytes - Len);
+    VoiceClipState.Addr += Len;
+    VoiceClipState.Size -= Len;
 
-    for (uint32_t i = 0; i < VOICE_BUF_LEN; i++)
+    if (VoiceClipState.Adpcm)
     {
-        gVoiceBuf[gVoiceBufWriteIndex][i] = VOICE_SAMPLES[Buf[i]];
+        for (uint32_t i = 0; i < Bytes; i++)
+        {
+            const uint8_t Codes = Raw[i];
+            Slot[2 * i]     = DecodeAdpcm(Codes & 0x0F);
+            Slot[2 * i + 1] = DecodeAdpcm(Codes >> 4);
+        }
+    }
+    else
+    {
+        for (uint32_t i = 0; i < VOICE_BUF_LEN; i++)
+        {
+            Slot[i] = VOICE_SAMPLES[Raw[i]];
+        }
     }
     VOICE_BUF_ForwardWriteIndex();
+
+    NVIC_DisableIRQ(DMA1_Channel2_3_IRQn);
     gVoiceBufLen++;
+    NVIC_EnableIRQ(DMA1_Channel2_3_IRQn);
+    return true;
+}
+
+static void AUDIO_PlayVoice(uint8_t VoiceID)
+{
+    VOICE_Stop();
+    gVoiceBufReadIndex  = 0;
+    gVoiceBufWriteIndex = 0;
+    gVoiceBufLen        = 0;
+
+    if (!LoadVoiceClip(VoiceID))
+    {
+        VoiceClipState.Size = 0;
+    }
+    while (LoadVoiceSamples())
+        ;
+
+    gVoiceStreaming = true;
+    VOICE_Start();
+}
+
+void AUDIO_VoiceService(void)
+{
+    if (!gVoiceStreaming)
+        return;
+
+    // the DMA interrupt frees a slot every 20 ms, top the queue up from flash
+    while (LoadVoiceSamples())
+        ;
+
+    if (VoiceClipState.Size == 0 && VOICE_IsIdle())
+    {
+        gVoiceStreaming      = false;
+        gFlagPlayQueuedVoice = true;
+    }
 }
 
 void AUDIO_PlaySingleVoice(bool bFlag)
 {
     uint8_t VoiceID;
-    uint8_t Delay;
 
     VoiceID = gVoiceID[0];
 
     if (gEeprom.VOICE_PROMPT != VOICE_PROMPT_OFF && gVoiceWriteIndex > 0)
     {
-        if (gEeprom.VOICE_PROMPT == VOICE_PROMPT_CHINESE)
-        {   // Chinese
-            if (VoiceID >= ARRAY_SIZE(VoiceClipLengthChinese))
-                goto Bailout;
-
-            Delay    = VoiceClipLengthChinese[VoiceID];
-            VoiceID += VOICE_ID_CHI_BASE;
-        }
-        else
-        {   // English
-            if (VoiceID >= ARRAY_SIZE(VoiceClipLengthEnglish))
-                goto Bailout;
-
-            Delay    = VoiceClipLengthEnglish[VoiceID];
-            VoiceID += VOICE_ID_ENG_BASE;
-        }
+        // the prompt table of the selected language is indexed by the plain ID
+        if (VoiceID >= VOICE_ID_END)
+            goto Bailout;
 
         if (FUNCTION_IsRx())   // 1of11
             BK4819_SetAF(BK4819_AF_MUTE);
@@ -353,12 +452,12 @@ void AUDIO_PlaySingleVoice(bool bFlag)
         SYSTEM_DelayMs(5);
         AUDIO_PlayVoice(VoiceID);
 
-        if (gVoiceWriteIndex == 1)
-            Delay += 3;
-
         if (bFlag)
         {
-            SYSTEM_DelayMs(Delay * 10);
+            while (gVoiceStreaming)
+                AUDIO_VoiceService();
+            gFlagPlayQueuedVoice = false;
+            VOICE_Stop();
 
             if (FUNCTION_IsRx())    // 1of11
                 RADIO_SetModulation(gRxVfo->Modulation);
@@ -381,9 +480,8 @@ void AUDIO_PlaySingleVoice(bool bFlag)
             return;
         }
 
-        gVoiceReadIndex                = 1;
-        gCountdownToPlayNextVoice_10ms = Delay;
-        gFlagPlayQueuedVoice           = false;
+        gVoiceReadIndex      = 1;
+        gFlagPlayQueuedVoice = false;
 
         return;
     }
@@ -450,46 +548,18 @@ Skip:
 void AUDIO_PlayQueuedVoice(void)
 {
     uint8_t VoiceID;
-    uint8_t Delay;
-    bool    Skip;
-
-    Skip = false;
 
     if (gVoiceReadIndex != gVoiceWriteIndex && gEeprom.VOICE_PROMPT != VOICE_PROMPT_OFF)
     {
         VoiceID = gVoiceID[gVoiceReadIndex];
-        if (gEeprom.VOICE_PROMPT == VOICE_PROMPT_CHINESE)
-        {
-            if (VoiceID < ARRAY_SIZE(VoiceClipLengthChinese))
-            {
-                Delay = VoiceClipLengthChinese[VoiceID];
-                VoiceID += VOICE_ID_CHI_BASE;
-            }
-            else
-                Skip = true;
-        }
-        else
-        {
-            if (VoiceID < ARRAY_SIZE(VoiceClipLengthEnglish))
-            {
-                Delay = VoiceClipLengthEnglish[VoiceID];
-                VoiceID += VOICE_ID_ENG_BASE;
-            }
-            else
-                Skip = true;
-        }
 
         gVoiceReadIndex++;
 
-        if (!Skip)
+        if (VoiceID < VOICE_ID_END)
         {
-            if (gVoiceReadIndex == gVoiceWriteIndex)
-                Delay += 3;
-
             AUDIO_PlayVoice(VoiceID);
 
-            gCountdownToPlayNextVoice_10ms = Delay;
-            gFlagPlayQueuedVoice           = false;
+            gFlagPlayQueuedVoice = false;
 
             #ifdef ENABLE_VOX
                 gVoxResumeCountdown = 2000;
@@ -499,6 +569,8 @@ void AUDIO_PlayQueuedVoice(void)
         }
     }
 
+    VOICE_Stop();
+
     if (FUNCTION_IsRx())
     {
         RADIO_SetModulation(gRxVfo->Modulation); // 1of11
@@ -145,7 +145,6 @@ void AUDIO_PlayBeep(BEEP_Type_t Beep);
     extern VOICE_ID_t        gVoiceID[8];
     extern uint8_t           gVoiceReadIndex;
     extern uint8_t           gVoiceWriteIndex;
-    extern volatile uint16_t gCountdownToPlayNextVoice_10ms;
     extern volatile bool     gFlagPlayQueuedVoice;
     extern VOICE_ID_t        gAnotherVoiceID;
     
@@ -153,6 +152,8 @@ void AUDIO_PlayBeep(BEEP_Type_t Beep);
     void    AUDIO_SetVoiceID(uint8_t Index, VOICE_ID_t VoiceID);
     uint8_t AUDIO_SetDigitVoice(uint8_t Index, uint16_t Value);
     void    AUDIO_PlayQueuedVoice(void);
+    // Streams the playing clip from flash, flags gFlagPlayQueuedVoice at its end
+    void    AUDIO_VoiceService(void);
 #endif
 
 #endif
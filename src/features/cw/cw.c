@@ -18,6 +18,7 @@
 #ifdef ENABLE_CW_KEYER
 
 #include <string.h>
+#include "py32f0xx.h"
 #include "drivers/bsp/bk4819.h"
 #include "drivers/bsp/system.h"
 #include "features/audio/audio.h"
@@ -27,13 +28,16 @@
 #include "drivers/bsp/st7565.h"
 #include "ui/helper.h"
 #include "ui/main.h"
+#ifdef ENABLE_CW_ENGINE
+#include "drivers/bsp/cw_timer.h"
+#endif
 
 extern bool gUpdateDisplay;
 extern volatile uint16_t gFlashLightBlinkCounter;
 
 // Global CW context
 CW_Context_t gCW;
-static uint16_t gCW_HangTimer_10ms = 0;
+static volatile uint16_t gCW_HangTimer_10ms = 0;
 #define CW_HANG_TIME_MS 500
 
 // Morse lookup table
@@ -114,8 +118,8 @@ static void CW_StartTX(void)
     AUDIO_AudioPathOn();
     gEnableSpeaker = true;
     
+    gCW.timerMs = CW_TX_RAMP_MS;
     gCW.state = CW_STATE_TX_STARTING;
-    gCW.timer_10ms = 2;  
 }
 
 // Internal: Stop TX
@@ -129,18 +133,48 @@ static void CW_StopTX(void)
     gCW.state = CW_STATE_IDLE;
 }
 
-static void CW_ToneOn(void) { BK4819_ExitTxMute(); }
-static void CW_ToneOff(void) { BK4819_EnterTxMute(); }
+// The engine runs from the TIM14 interrupt with ENABLE_CW_ENGINE. The BK4819
+// bus is bit-banged from thread context as well, so the engine only touches
+// it between transfers and retries on the next tick otherwise.
+static inline bool CW_BusFree(void)
+{
+#ifdef ENABLE_CW_ENGINE
+    return !BK4819_IsBusBusy();
+#else
+    return true;
+#endif
+}
 
-static bool CW_QueuePush(CW_Element_t elem)
+static bool CW_ToneOn(void)
 {
-    if (gCW.queueCount >= CW_QUEUE_SIZE) return false;
-    gCW.queue[gCW.queueTail] = elem;
-    gCW.queueTail = (gCW.queueTail + 1) % CW_QUEUE_SIZE;
-    gCW.queueCount++;
+    if (!CW_BusFree()) return false;
+    BK4819_ExitTxMute();
+    return true;
+}
+
+static bool CW_ToneOff(void)
+{
+    if (!CW_BusFree()) return false;
+    BK4819_EnterTxMute();
     return true;
 }
 
+static bool CW_QueuePush(CW_Element_t elem)
+{
+    bool pushed = false;
+
+    // the engine pops from the other end
+    __disable_irq();
+    if (gCW.queueCount < CW_QUEUE_SIZE) {
+        gCW.queue[gCW.queueTail] = elem;
+        gCW.queueTail = (gCW.queueTail + 1) % CW_QUEUE_SIZE;
+        gCW.queueCount++;
+        pushed = true;
+    }
+    __enable_irq();
+    return pushed;
+}
+
 static bool CW_QueuePop(CW_Element_t *elem)
 {
     if (gCW.queueCount == 0) return false;
@@ -150,6 +184,25 @@ static bool CW_QueuePop(CW_Element_t *elem)
     return true;
 }
 
+// Engine side: hand a keyed or received element to the 10ms path
+static void CW_PushElement(bool isDah)
+{
+    const uint8_t next = (gCW.elemHead + 1) % CW_ELEM_RING_SIZE;
+    if (next == gCW.elemTail) return;
+    gCW.elemRing[gCW.elemHead] = isDah;
+    gCW.elemHead = next;
+}
+
+static void CW_DrainElements(void)
+{
+    while (gCW.elemTail != gCW.elemHead) {
+        const bool isDah = gCW.elemRing[gCW.elemTail];
+        gCW.elemTail = (gCW.elemTail + 1) % CW_ELEM_RING_SIZE;
+        if (gCW.decodeCount < CW_ELEMENT_BUF_SIZE) gCW.decodeBuf[gCW.decodeCount++] = isDah;
+        CW_AddSymbol(isDah ? '-' : '.');
+    }
+}
+
 void CW_Init(void)
 {
     memset(&gCW, 0, sizeof(gCW));
@@ -174,257 +227,310 @@ static void CW_ProcessPaddles(void)
     if (gCW.paddle.dah) gCW.paddle.latchDah = true;
 }
 
-void CW_Tick10ms(void)
+// Falling edge of a received mark: classify it and adapt to the sender's speed
+static void CW_ClassifyMark(uint16_t ms)
 {
-    // -------------------------------------------------------------------------
-    // RX Processing
-    // -------------------------------------------------------------------------
-    // AGC Management: Disable for CW to get sharp R/A drops, restore otherwise.
-    bool inCwMode = (gRxVfo->Modulation == MODULATION_CW);
-    bool isRxOrForeground = (FUNCTION_IsRx() || gCurrentFunction == FUNCTION_FOREGROUND);
-    
-    if (inCwMode && isRxOrForeground) {
-        if (!gCW.wasAgcEnabled) { // Borrowing this as "is AGC currently disabled by us"
-            BK4819_SetAGC(false);
-            gCW.wasAgcEnabled = true;
-        }
-    } else if (gCW.wasAgcEnabled) {
-        BK4819_SetAGC(true);
-        gCW.wasAgcEnabled = false;
+    if (ms <= 2 * CW_RX_SAMPLE_MS || ms >= 1000) return;
+
+    uint16_t distDot = (ms > gCW.avgDotMs) ? (ms - gCW.avgDotMs) : (gCW.avgDotMs - ms);
+    uint16_t distDash = (ms > gCW.avgDashMs) ? (ms - gCW.avgDashMs) : (gCW.avgDashMs - ms);
+    bool isDah = (distDash < distDot);
+
+    if (!isDah) {
+        gCW.avgDotMs = (gCW.avgDotMs * 7 + ms) / 8;
+        if (gCW.avgDashMs < gCW.avgDotMs * 2) gCW.avgDashMs = gCW.avgDotMs * 3;
+    } else {
+        gCW.avgDashMs = (gCW.avgDashMs * 7 + ms) / 8;
+        if (gCW.avgDotMs > gCW.avgDashMs / 2) gCW.avgDotMs = gCW.avgDashMs / 3;
     }
+    if (gCW.avgDotMs < 20) gCW.avgDotMs = 20;
+    if (gCW.avgDotMs > 250) gCW.avgDotMs = 250;
+    if (gCW.avgDashMs < 60) gCW.avgDashMs = 60;
+    if (gCW.avgDashMs > 750) gCW.avgDashMs = 750;
 
-    if (gCW.state == CW_STATE_IDLE && isRxOrForeground && inCwMode) {
-        uint16_t rssi = BK4819_GetRSSI();
-        uint8_t noise = BK4819_GetExNoiseIndicator();
-        uint8_t afTxRx = BK4819_GetAfTxRx();
-        
-        gCW.lastRSSI = rssi;
-        gCW.lastNoise = noise;
-        gCW.lastAf = afTxRx;
-        gUpdateDisplay = true; 
-        
-        bool startup = (gCW.rxSignalTimer_10ms == 0 && gCW.rxGapTimer_10ms < 200); 
-        
-        bool rssiTrigger = (rssi >= gCW.avgNoiseRSSI + 12); 
-        bool rssiHold    = (rssi >= gCW.avgNoiseRSSI + 6);  
-        
-        // --- Envelope Follower for AF Level (A) ---
-        // noiseFloor: slowly tracks when signal is OFF
-        // signalPeak: fast attack, slow leak when signal is ON
-        if (!gCW.rxSignalOn) {
-            // Update noise floor slowly
-            gCW.rxNoiseFloor = (gCW.rxNoiseFloor * 63 + afTxRx) / 64;
-            if (gCW.rxNoiseFloor < 2) gCW.rxNoiseFloor = 2;
+    CW_PushElement(isDah);
+}
+
+// Engine side of the receiver: one envelope sample and the mark/space
+// decision. The floors it compares against are tracked by CW_TrackRx.
+static void CW_SampleRx(void)
+{
+    uint16_t rssi = BK4819_GetRSSI();
+    uint8_t noise = BK4819_GetExNoiseIndicator();
+    uint8_t afTxRx = BK4819_GetAfTxRx();
+    
+    gCW.lastRSSI = rssi;
+    gCW.lastNoise = noise;
+    gCW.lastAf = afTxRx;
+    
+    bool startup = (gCW.rxSignalMs == 0 && gCW.rxGapMs < 2000); 
+    
+    bool rssiTrigger = (rssi >= gCW.avgNoiseRSSI + 12); 
+    bool rssiHold    = (rssi >= gCW.avgNoiseRSSI + 6);  
+
+    // Peak follower: fast attack here, slow leak in CW_TrackRx
+    if (gCW.rxSignalOn && afTxRx > gCW.rxSignalPeak) gCW.rxSignalPeak = afTxRx;
+
+    // Schmitt Trigger Logic
+    uint16_t threshold = gCW.rxNoiseFloor + (gCW.rxSignalPeak - gCW.rxNoiseFloor) / 2;
+    bool afTrigger = (afTxRx > threshold + 2);
+    bool afHold    = (afTxRx > threshold - 2);
+
+    // 3. Noise Indicator (M) - Primary Carrier Release
+    bool mStartTrigger = (noise < gCW.avgNoiseIndicator - 16);
+    bool mHoldTrigger  = (noise < gCW.avgNoiseIndicator - 8);
+
+    bool signalDetected;
+    if (!gCW.rxSignalOn) {
+        // Signal START requires AF trigger AND M drop (AND RSSI jump for safety)
+        signalDetected = afTrigger && mStartTrigger && rssiTrigger;
+    } else {
+        // Signal HOLD: prioritize AF and M release
+        if (rssi > gCW.avgNoiseRSSI + 100) {
+            signalDetected = afHold && mHoldTrigger;
         } else {
-            // Update peak: fast attack
-            if (afTxRx > gCW.rxSignalPeak) gCW.rxSignalPeak = afTxRx;
-            // Slow leak (decay) to follow fading
-            else gCW.rxSignalPeak = (gCW.rxSignalPeak * 511 + afTxRx) / 512;
-            
-            if (gCW.rxSignalPeak < gCW.rxNoiseFloor + 10) gCW.rxSignalPeak = gCW.rxNoiseFloor + 10;
+            signalDetected = (rssiHold || afHold) && mHoldTrigger;
         }
+    }
 
-        // Schmitt Trigger Logic
-        uint16_t threshold = gCW.rxNoiseFloor + (gCW.rxSignalPeak - gCW.rxNoiseFloor) / 2;
-        bool afTrigger = (afTxRx > threshold + 2);
-        bool afHold    = (afTxRx > threshold - 2);
-
-        // 3. Noise Indicator (M) - Primary Carrier Release
-        bool mStartTrigger = (noise < gCW.avgNoiseIndicator - 16);
-        bool mHoldTrigger  = (noise < gCW.avgNoiseIndicator - 8);
-
-        bool signalDetected;
-        if (!gCW.rxSignalOn) {
-            // Signal START requires AF trigger AND M drop (AND RSSI jump for safety)
-            signalDetected = afTrigger && mStartTrigger && rssiTrigger;
-        } else {
-            // Signal HOLD: prioritize AF and M release
-            if (rssi > gCW.avgNoiseRSSI + 100) {
-                signalDetected = afHold && mHoldTrigger;
+    // Glitch Filter / Debouncer
+    if (signalDetected != gCW.rxSignalOn) {
+        gCW.rxGlitchMs += CW_RX_SAMPLE_MS;
+        if (gCW.rxGlitchMs >= CW_GLITCH_MS || startup) { 
+            gCW.rxSignalOn = signalDetected;
+            gCW.rxGlitchMs = 0;
+            
+            if (gCW.rxSignalOn) {
+                gCW.rxSignalMs = 0;
             } else {
-                signalDetected = (rssiHold || afHold) && mHoldTrigger;
+                CW_ClassifyMark(gCW.rxSignalMs);
             }
+            gCW.rxGapMs = 0;
         }
+    } else {
+        gCW.rxGlitchMs = 0;
+    }
 
-        // Glitch Filter / Debouncer (30ms)
-        if (signalDetected != gCW.rxSignalOn) {
-            gCW.rxGlitchTimer_10ms++;
-            if (gCW.rxGlitchTimer_10ms >= 3 || startup) { 
-                gCW.rxSignalOn = signalDetected;
-                gCW.rxGlitchTimer_10ms = 0;
-                
-                if (gCW.rxSignalOn) {
-                    gCW.rxSignalTimer_10ms = 0;
-                    gCW.rxGapTimer_10ms = 0;
-                } else {
-                    // FALLING EDGE: Classify element
-                    uint16_t ms = gCW.rxSignalTimer_10ms * 10;
-                    if (ms > 20 && ms < 1000) {
-                        uint16_t distDot = (ms > gCW.avgDotMs) ? (ms - gCW.avgDotMs) : (gCW.avgDotMs - ms);
-                        uint16_t distDash = (ms > gCW.avgDashMs) ? (ms - gCW.avgDashMs) : (gCW.avgDashMs - ms);
-                        bool isDah = (distDash < distDot);
-
-                        if (!isDah) {
-                            gCW.avgDotMs = (gCW.avgDotMs * 7 + ms) / 8;
-                            if (gCW.avgDashMs < gCW.avgDotMs * 2) gCW.avgDashMs = gCW.avgDotMs * 3;
-                        } else {
-                            gCW.avgDashMs = (gCW.avgDashMs * 7 + ms) / 8;
-                            if (gCW.avgDotMs > gCW.avgDashMs / 2) gCW.avgDotMs = gCW.avgDashMs / 3;
-                        }
-                        if (gCW.avgDotMs < 20) gCW.avgDotMs = 20;
-                        if (gCW.avgDotMs > 250) gCW.avgDotMs = 250;
-                        if (gCW.avgDashMs < 60) gCW.avgDashMs = 60;
-                        if (gCW.avgDashMs > 750) gCW.avgDashMs = 750;
-
-                        if (gCW.decodeCount < CW_ELEMENT_BUF_SIZE) 
-                            gCW.decodeBuf[gCW.decodeCount++] = isDah ? 1 : 0;
-                        CW_AddSymbol(isDah ? '-' : '.');
-                    }
-                    gCW.rxGapTimer_10ms = 0;
-                }
-            }
-        } else {
-            gCW.rxGlitchTimer_10ms = 0;
-        }
+    if (gCW.rxSignalOn) {
+        if (gCW.rxSignalMs < UINT16_MAX - CW_RX_SAMPLE_MS) gCW.rxSignalMs += CW_RX_SAMPLE_MS;
+    } else {
+        if (gCW.rxGapMs < UINT16_MAX - CW_RX_SAMPLE_MS) gCW.rxGapMs += CW_RX_SAMPLE_MS;
+    }
+}
 
-        if (gCW.rxSignalOn) {
-            gCW.rxSignalTimer_10ms++;
-        } else {
-            // Floor Tracking for RSSI and M
-            uint16_t alpha = startup ? 7 : 63; 
-            if (rssi > gCW.avgNoiseRSSI) alpha = 15; 
-            gCW.avgNoiseRSSI = (gCW.avgNoiseRSSI * alpha + rssi) / (alpha + 1);
-            gCW.avgNoiseIndicator = (gCW.avgNoiseIndicator * alpha + noise) / (alpha + 1);
-            if (gCW.avgNoiseRSSI < 10) gCW.avgNoiseRSSI = 10;
-
-            // Gap Processing
-            gCW.rxGapTimer_10ms++;
-            uint16_t gapMs = gCW.rxGapTimer_10ms * 10;
-            uint16_t dotLen = gCW.avgDotMs;
-            if (gapMs >= (dotLen * 5) / 2) { 
-                if (gCW.decodeCount > 0) {
-                    CW_AddDecodedChar(CW_DecodeElements());
-                    gCW.decodeCount = 0;
-                }
-            }
-            if (gapMs >= (dotLen * 5)) {
-                if (gCW.textLen > 0 && gCW.textBuf[gCW.textLen-1] != ' ') {
-                    CW_AddDecodedChar(' ');
-                }
-                gCW.rxGapTimer_10ms = 0; 
-            }
+// 10ms side of the receiver: slow floor/peak tracking on the latest sample,
+// character and word gaps
+static void CW_TrackRx(void)
+{
+    const uint16_t rssi = gCW.lastRSSI;
+    const uint8_t noise = gCW.lastNoise;
+    const uint8_t afTxRx = gCW.lastAf;
+
+    gUpdateDisplay = true; 
+
+    // --- Envelope Follower for AF Level (A) ---
+    // noiseFloor: slowly tracks when signal is OFF
+    // signalPeak: slow leak when signal is ON to follow fading
+    if (!gCW.rxSignalOn) {
+        gCW.rxNoiseFloor = (gCW.rxNoiseFloor * 63 + afTxRx) / 64;
+        if (gCW.rxNoiseFloor < 2) gCW.rxNoiseFloor = 2;
+
+        // Floor Tracking for RSSI and M
+        bool startup = (gCW.rxSignalMs == 0 && gCW.rxGapMs < 2000); 
+        uint16_t alpha = startup ? 7 : 63; 
+        if (rssi > gCW.avgNoiseRSSI) alpha = 15; 
+        gCW.avgNoiseRSSI = (gCW.avgNoiseRSSI * alpha + rssi) / (alpha + 1);
+        gCW.avgNoiseIndicator = (gCW.avgNoiseIndicator * alpha + noise) / (alpha + 1);
+        if (gCW.avgNoiseRSSI < 10) gCW.avgNoiseRSSI = 10;
+    } else {
+        gCW.rxSignalPeak = (gCW.rxSignalPeak * 511 + afTxRx) / 512;
+        if (gCW.rxSignalPeak < gCW.rxNoiseFloor + 10) gCW.rxSignalPeak = gCW.rxNoiseFloor + 10;
+        return;
+    }
+
+    // Gap Processing
+    uint16_t gapMs = gCW.rxGapMs;
+    uint16_t dotLen = gCW.avgDotMs;
+    if (gapMs >= (dotLen * 5) / 2) { 
+        if (gCW.decodeCount > 0) {
+            CW_AddDecodedChar(CW_DecodeElements());
+            gCW.decodeCount = 0;
+        }
+    }
+    if (gapMs >= (dotLen * 5)) {
+        if (gCW.textLen > 0 && gCW.textBuf[gCW.textLen-1] != ' ') {
+            CW_AddDecodedChar(' ');
         }
     }
+}
 
-    // -------------------------------------------------------------------------
-    // TX Processing
-    // -------------------------------------------------------------------------
-    CW_ProcessPaddles();
+// Engine side of the keyer. Tone edges are retried on the next tick while
+// the bus is busy, the timer keeps running meanwhile.
+static void CW_TickTx(void)
+{
+    static bool lastWasDit = false;
 
-    if (gCW.state == CW_STATE_IDLE && (gCW.paddle.latchDit || gCW.paddle.latchDah || gCW.queueCount > 0)) {
-        CW_StartTX();
-        return;
-    }
-    
     switch (gCW.state) {
         case CW_STATE_TX_STARTING:
-            if (gCW.timer_10ms > 0) gCW.timer_10ms--;
+            if (gCW.timerMs >= CW_TICK_MS) gCW.timerMs -= CW_TICK_MS;
             else {
                 gCW.state = CW_STATE_GAP; 
-                gCW.timer_10ms = 0;
-                gCW.duration_10ms = 0;
+                gCW.timerMs = 0;
+                gCW.durationMs = 0;
             }
             break;
             
         case CW_STATE_PLAYING_TONE:
-            gCW.timer_10ms++;
-            if (gCW.timer_10ms >= gCW.duration_10ms) {
-                CW_ToneOff();
+            gCW.timerMs += CW_TICK_MS;
+            if (gCW.timerMs >= gCW.durationMs && CW_ToneOff()) {
                 gCW.state = CW_STATE_GAP;
-                gCW.timer_10ms = 0;
-                gCW.duration_10ms = CW_ELEMENT_GAP_MS / 10;
+                gCW.timerMs = 0;
+                gCW.durationMs = CW_ELEMENT_GAP_MS;
             }
             break;
             
-        case CW_STATE_GAP:
-            gCW.timer_10ms++;
-            gCW.gapTimer_10ms++;
-            if (gCW.timer_10ms >= gCW.duration_10ms) {
-                bool playDit = false, playDah = false;
-                static bool lastWasDit = false;
-
-                if (gCW.paddle.latchDit && gCW.paddle.latchDah) { if (lastWasDit) playDah = true; else playDit = true; }
-                else if (gCW.paddle.latchDit) playDit = true;
-                else if (gCW.paddle.latchDah) playDah = true;
-                else {
-                    CW_Element_t elem;
-                    if (CW_QueuePop(&elem)) {
-                        if (elem == CW_ELEM_DIT) playDit = true;
-                        else if (elem == CW_ELEM_DAH) playDah = true;
-                        else if (elem == CW_ELEM_STRAIGHT_START) {
-                            CW_ToneOn();
-                            gCW.state = CW_STATE_STRAIGHT_TONE;
-                            gCW.straightTimer_10ms = 0;
-                            return;
-                        }
-                    }
-                }
-
-                if (playDit) {
-                    gCW.paddle.latchDit = false; lastWasDit = true;
-                    CW_ToneOn(); gCW.state = CW_STATE_PLAYING_TONE;
-                    gCW.duration_10ms = CW_DOT_MS / 10; gCW.timer_10ms = 0; gCW.gapTimer_10ms = 0;
-                    if (gCW.decodeCount < CW_ELEMENT_BUF_SIZE) gCW.decodeBuf[gCW.decodeCount++] = 0;
-                    CW_AddSymbol('.');
-                } else if (playDah) {
-                    gCW.paddle.latchDah = false; lastWasDit = false;
-                    CW_ToneOn(); gCW.state = CW_STATE_PLAYING_TONE;
-                    gCW.duration_10ms = CW_DASH_MS / 10; gCW.timer_10ms = 0; gCW.gapTimer_10ms = 0;
-                    if (gCW.decodeCount < CW_ELEMENT_BUF_SIZE) gCW.decodeBuf[gCW.decodeCount++] = 1;
-                    CW_AddSymbol('-');
-                } else {
-                    gCW_HangTimer_10ms = 0;
-                    gCW.state = CW_STATE_IDLE;
-                }
+        case CW_STATE_GAP: {
+            gCW.timerMs += CW_TICK_MS;
+            if (gCW.gapMs < UINT16_MAX - CW_TICK_MS) gCW.gapMs += CW_TICK_MS;
+            if (gCW.timerMs < gCW.durationMs) break;
+
+            CW_Element_t elem;
+            bool fromPaddle = true;
+
+            if (gCW.paddle.latchDit && gCW.paddle.latchDah) elem = lastWasDit ? CW_ELEM_DAH : CW_ELEM_DIT;
+            else if (gCW.paddle.latchDit) elem = CW_ELEM_DIT;
+            else if (gCW.paddle.latchDah) elem = CW_ELEM_DAH;
+            else if (gCW.queueCount > 0) { elem = gCW.queue[gCW.queueHead]; fromPaddle = false; }
+            else {
+                gCW_HangTimer_10ms = 0;
+                gCW.state = CW_STATE_IDLE;
+                break;
             }
-            break;
-            
-        case CW_STATE_IDLE:
-            if (FUNCTION_IsTx()) {
-                gCW.gapTimer_10ms++;
-                uint16_t gapMs = gCW.gapTimer_10ms * 10;
-                uint16_t dotLen = CW_DOT_MS;
-                if (gapMs >= (dotLen * 25) / 10) { 
-                    if (gCW.decodeCount > 0) { CW_AddDecodedChar(CW_DecodeElements()); gCW.decodeCount = 0; }
-                }
-                if (gapMs >= (dotLen * 5)) {
-                    if (gCW.textLen > 0 && gCW.textBuf[gCW.textLen-1] != ' ') CW_AddDecodedChar(' ');
-                    gCW.gapTimer_10ms = 0;
-                }
-                gCW_HangTimer_10ms++;
-                if (gCW_HangTimer_10ms * 10 >= CW_HANG_TIME_MS && gCW.queueCount == 0 && !gCW.paddle.dit && !gCW.paddle.dah && !gCW.straightKeyDown) {
-                    CW_StopTX();
-                }
+
+            if (elem == CW_ELEM_STRAIGHT_STOP) {
+                // key released before its tone could start
+                CW_QueuePop(&elem);
+                gCW_HangTimer_10ms = 0;
+                gCW.state = CW_STATE_IDLE;
+                break;
             }
+
+            if (!CW_ToneOn()) break;
+
+            if (!fromPaddle) CW_QueuePop(&elem);
+            else if (elem == CW_ELEM_DIT) gCW.paddle.latchDit = false;
+            else gCW.paddle.latchDah = false;
+
+            gCW.timerMs = 0;
+            gCW.gapMs = 0;
+
+            if (elem == CW_ELEM_STRAIGHT_START) {
+                gCW.state = CW_STATE_STRAIGHT_TONE;
+                gCW.straightMs = 0;
+                break;
+            }
+
+            lastWasDit = (elem == CW_ELEM_DIT);
+            gCW.state = CW_STATE_PLAYING_TONE;
+            gCW.durationMs = lastWasDit ? CW_DOT_MS : CW_DASH_MS;
+            CW_PushElement(!lastWasDit);
             break;
+        }
             
         case CW_STATE_STRAIGHT_TONE:
-            gCW.straightTimer_10ms++;
-            if (gCW.queueCount > 0 && gCW.queue[gCW.queueHead] == CW_ELEM_STRAIGHT_STOP) {
-                if (gCW.straightTimer_10ms * 10 < CW_DOT_MS) return; 
+            if (gCW.straightMs < UINT16_MAX - CW_TICK_MS) gCW.straightMs += CW_TICK_MS;
+            if (gCW.queueCount > 0 && gCW.queue[gCW.queueHead] == CW_ELEM_STRAIGHT_STOP &&
+                gCW.straightMs >= CW_DOT_MS && CW_ToneOff()) {
                 CW_Element_t dummy; CW_QueuePop(&dummy);
-                CW_ToneOff();
-                uint16_t ms = gCW.straightTimer_10ms * 10;
-                bool isDah = ms >= 150;
-                if (gCW.decodeCount < CW_ELEMENT_BUF_SIZE) gCW.decodeBuf[gCW.decodeCount++] = isDah ? 1 : 0;
-                CW_AddSymbol(isDah ? '-' : '.');
-                gCW.state = CW_STATE_GAP; gCW.timer_10ms = 0; gCW.duration_10ms = CW_ELEMENT_GAP_MS / 10; gCW.gapTimer_10ms = 0;
+                CW_PushElement(gCW.straightMs >= 150);
+                gCW.state = CW_STATE_GAP; gCW.timerMs = 0; gCW.durationMs = CW_ELEMENT_GAP_MS; gCW.gapMs = 0;
             }
             break;
         default: break;
     }
 }
 
+void CW_EngineTick(void)
+{
+    CW_ProcessPaddles();
+
+    if (gCW.state != CW_STATE_IDLE) {
+        CW_TickTx();
+        return;
+    }
+
+    if (gCW.gapMs < UINT16_MAX - CW_TICK_MS) gCW.gapMs += CW_TICK_MS;
+
+    if (gCW.rxActive) {
+        if (gCW.rxSampleMs < CW_RX_SAMPLE_MS) gCW.rxSampleMs += CW_TICK_MS;
+        if (gCW.rxSampleMs >= CW_RX_SAMPLE_MS && CW_BusFree()) {
+            gCW.rxSampleMs = 0;
+            CW_SampleRx();
+        }
+    }
+}
+
+void CW_Tick10ms(void)
+{
+    // -------------------------------------------------------------------------
+    // RX Processing
+    // -------------------------------------------------------------------------
+    // AGC Management: Disable for CW to get sharp R/A drops, restore otherwise.
+    bool inCwMode = (gRxVfo->Modulation == MODULATION_CW);
+    bool isRxOrForeground = (FUNCTION_IsRx() || gCurrentFunction == FUNCTION_FOREGROUND);
+    
+    if (inCwMode && isRxOrForeground) {
+        if (!gCW.wasAgcEnabled) { // Borrowing this as "is AGC currently disabled by us"
+            BK4819_SetAGC(false);
+            gCW.wasAgcEnabled = true;
+        }
+    } else if (gCW.wasAgcEnabled) {
+        BK4819_SetAGC(true);
+        gCW.wasAgcEnabled = false;
+    }
+
+    gCW.rxActive = inCwMode && isRxOrForeground;
+
+#ifndef ENABLE_CW_ENGINE
+    CW_EngineTick();
+#endif
+
+    CW_DrainElements();
+
+    if (gCW.state == CW_STATE_IDLE && gCW.rxActive) {
+        CW_TrackRx();
+    }
+
+    // -------------------------------------------------------------------------
+    // TX Processing
+    // -------------------------------------------------------------------------
+    if (gCW.state == CW_STATE_IDLE && (gCW.paddle.latchDit || gCW.paddle.latchDah ||
+                                       gCW.paddle.dit || gCW.paddle.dah || gCW.queueCount > 0)) {
+        CW_StartTX();
+    } else if (gCW.state == CW_STATE_IDLE && FUNCTION_IsTx()) {
+        uint16_t gapMs = gCW.gapMs;
+        uint16_t dotLen = CW_DOT_MS;
+        if (gapMs >= (dotLen * 25) / 10) { 
+            if (gCW.decodeCount > 0) { CW_AddDecodedChar(CW_DecodeElements()); gCW.decodeCount = 0; }
+        }
+        if (gapMs >= (dotLen * 5)) {
+            if (gCW.textLen > 0 && gCW.textBuf[gCW.textLen-1] != ' ') CW_AddDecodedChar(' ');
+        }
+        gCW_HangTimer_10ms++;
+        if (gCW_HangTimer_10ms * 10 >= CW_HANG_TIME_MS && gCW.queueCount == 0 && !gCW.paddle.dit && !gCW.paddle.dah && !gCW.straightKeyDown) {
+            CW_StopTX();
+        }
+    }
+
+#ifdef ENABLE_CW_ENGINE
+    // the hang after the last element still counts gapMs for the decoder
+    if (gCW.state != CW_STATE_IDLE || gCW.rxActive || FUNCTION_IsTx())
+        CW_TIMER_Start();
+    else
+        CW_TIMER_Stop();
+#endif
+}
+
 bool CW_IsBusy(void) { return gCW.state != CW_STATE_IDLE || gCW.queueCount > 0; }
 const char* CW_GetDecodedText(void) { return gCW.textBuf; }
 const char* CW_GetSymbolBuffer(void) { return gCW.symbolBuf; }
@@ -28,10 +28,24 @@
 #define CW_ELEMENT_GAP_MS       80      // Gap between elements = 1 dot
 #define CW_CHAR_GAP_MS          240     // Gap between characters = 3 dots
 #define CW_WORD_GAP_MS          560     // Gap between words = 7 dots
+#define CW_TX_RAMP_MS           30      // TX settle time before the first element
+
+// Engine step: keyer and decoder timing advance by CW_TICK_MS per
+// CW_EngineTick, the RX envelope is sampled every CW_RX_SAMPLE_MS
+#ifdef ENABLE_CW_ENGINE
+#define CW_TICK_MS              1       // TIM14 interrupt
+#define CW_RX_SAMPLE_MS         2
+#define CW_GLITCH_MS            8       // RX debounce
+#else
+#define CW_TICK_MS              10      // CW_Tick10ms
+#define CW_RX_SAMPLE_MS         10
+#define CW_GLITCH_MS            30
+#endif
 
 #define CW_QUEUE_SIZE           32      // Element queue size
 #define CW_DECODE_BUF_SIZE      22      // Decoded text buffer (fills one line)
 #define CW_ELEMENT_BUF_SIZE     8       // Elements per character for decoder
+#define CW_ELEM_RING_SIZE       8       // Keyed/received elements awaiting the 10ms path
 
 // Element types in queue
 typedef enum {
@@ -52,17 +66,17 @@ typedef enum {
 
 // CW Module Context
 typedef struct {
-    CW_State_t      state;
+    volatile CW_State_t state;
     
     // Element queue
     CW_Element_t    queue[CW_QUEUE_SIZE];
     uint8_t         queueHead;
     uint8_t         queueTail;
-    uint8_t         queueCount;
+    volatile uint8_t queueCount;
     
     // Current element timing
-    uint16_t        timer_10ms;
-    uint16_t        duration_10ms;
+    uint16_t        timerMs;
+    uint16_t        durationMs;
     
     // Paddle state (for iambic generation)
     struct {
@@ -76,10 +90,16 @@ typedef struct {
     
     // Straight key state
     bool            straightKeyDown;
-    uint16_t        straightTimer_10ms;
+    uint16_t        straightMs;
     
     // Gap timing for decoder
-    uint16_t        gapTimer_10ms;
+    uint16_t        gapMs;
+
+    // Elements (0 dit, 1 dah) classified by the engine, decoded to text by
+    // CW_Tick10ms
+    uint8_t         elemRing[CW_ELEM_RING_SIZE];
+    volatile uint8_t elemHead;
+    volatile uint8_t elemTail;
     
     // Adaptive WPM tracking
     uint16_t        avgDotMs;
@@ -99,10 +119,12 @@ typedef struct {
     uint8_t         symbolLen;
     
     // RX Decode State
+    bool            rxActive;       // CW receive in progress, engine samples the envelope
     bool            rxSignalOn;
-    uint16_t        rxSignalTimer_10ms;
-    uint16_t        rxGapTimer_10ms;
-    uint16_t        rxGlitchTimer_10ms;
+    uint16_t        rxSignalMs;
+    uint16_t        rxGapMs;
+    uint16_t        rxGlitchMs;
+    uint8_t         rxSampleMs;
     uint16_t        avgNoiseRSSI;
     uint16_t        avgGlitch;
     uint16_t        avgNoiseIndicator;
@@ -121,7 +143,8 @@ extern CW_Context_t gCW;
 
 // Main API
 void CW_Init(void);
-void CW_Tick10ms(void);         // Called every 10ms
+void CW_Tick10ms(void);         // Called every 10ms: TX start/hang, text, UI
+void CW_EngineTick(void);       // Element timing and RX sampling, every CW_TICK_MS
 
 // Key inputs (state based for iambic)
 void CW_SetDitPaddle(bool pressed);
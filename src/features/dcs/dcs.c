@@ -45,6 +45,16 @@ const uint16_t DCS_Options[104] = {
     0x01C3, 0x01CA, 0x01D3, 0x01D9, 0x01DA, 0x01DC, 0x01E3, 0x01EC,
 };
 
+#ifdef ENABLE_DCS_FEC
+// Syndromes of the 23 single bit errors, bit 0 first. Golay(23,12) could
+// correct three, but tried on all 23 rotations that makes most noise words
+// decode to some code; one flip keeps false hits near the exact-match rate.
+static const uint16_t DCS_SingleErrorSyndromes[23] = {
+    0x475, 0x49F, 0x54B, 0x6E3, 0x1B3, 0x366, 0x6CC, 0x1ED, 0x3DA, 0x7B4, 0x31D, 0x63A,
+    0x001, 0x002, 0x004, 0x008, 0x010, 0x020, 0x040, 0x080, 0x100, 0x200, 0x400,
+};
+#endif
+
 static uint32_t DCS_CalculateGolay(uint32_t CodeWord)
 {
     unsigned int i;
@@ -66,20 +76,75 @@ uint32_t DCS_GetGolayCodeWord(DCS_CodeType_t CodeType, uint8_t Option)
     return Code;
 }
 
+// Zero for codewords, the code is linear so it only depends on the errors
+static uint16_t DCS_GetSyndrome(uint32_t Word)
+{
+    return (DCS_CalculateGolay(Word & 0xFFFU) ^ Word) >> 12;
+}
+
+// DCS_Options is sorted, so it doubles as the code to option index
+static uint8_t DCS_FindOption(uint16_t Code)
+{
+    unsigned int Low  = 0;
+    unsigned int High = ARRAY_SIZE(DCS_Options);
+
+    while (Low < High)
+    {
+        const unsigned int Mid = (Low + High) / 2;
+        if (DCS_Options[Mid] < Code)
+            Low = Mid + 1;
+        else
+            High = Mid;
+    }
+
+    return (Low < ARRAY_SIZE(DCS_Options) && DCS_Options[Low] == Code) ? Low : 0xFF;
+}
+
 uint8_t DCS_GetCdcssCode(uint32_t Code)
 {
     unsigned int i;
+    uint8_t      Result = 0xFF;
+    uint8_t      Fewest = 0xFF;
+
+    // the word can start at any bit, keep the rotation needing the fewest flips
     for (i = 0; i < 23; i++)
     {
-        uint32_t Shift;
+        const uint16_t Syndrome = DCS_GetSyndrome(Code);
+        uint16_t       Data     = Code & 0xFFFU;
+        uint8_t        Errors   = 0;
+        uint32_t       Shift;
+#ifdef ENABLE_DCS_FEC
+        unsigned int   Bit;
+#endif
 
-        if (((Code >> 9) & 0x7U) == 4)
+        if (Syndrome)
         {
-            unsigned int j;
-            for (j = 0; j < ARRAY_SIZE(DCS_Options); j++)
-                if (DCS_Options[j] == (Code & 0x1FF))
-                    if (DCS_GetGolayCodeWord(2, j) == Code)
-                        return j;
+            Errors = 0xFF;
+#ifdef ENABLE_DCS_FEC
+            for (Bit = 0; Bit < ARRAY_SIZE(DCS_SingleErrorSyndromes); Bit++)
+            {
+                if (DCS_SingleErrorSyndromes[Bit] == Syndrome)
+                {
+                    // parity flips don't matter, the code is rebuilt from the data
+                    if (Bit < 12)
+                        Data ^= 1U << Bit;
+                    Errors = 1;
+                    break;
+                }
+            }
+#endif
+        }
+
+        if (Errors < Fewest && (Data >> 9) == 4)
+        {
+            const uint8_t Option = DCS_FindOption(Data & 0x1FFU);
+            if (Option != 0xFF)
+            {
+                Result = Option;
+                Fewest = Errors;
+                if (Errors == 0)
+                    break;
+            }
         }
 
         Shift = Code >> 1;
@@ -88,7 +153,7 @@ uint8_t DCS_GetCdcssCode(uint32_t Code)
         Code = Shift;
     }
 
-    return 0xFF;
+    return Result;
 }
 
 uint8_t DCS_GetCtcssCode(int Code)
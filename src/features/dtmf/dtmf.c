@@ -43,7 +43,6 @@ char              gDTMF_RX_live[20];
 uint8_t           gDTMF_RX_live_timeout = 0;
 
 #ifdef ENABLE_DTMF_CALLING
-char              gDTMF_RX[17];
 uint8_t           gDTMF_RX_index   = 0;
 uint8_t           gDTMF_RX_timeout = 0;
 bool              gDTMF_RX_pending = false;
@@ -67,12 +66,174 @@ bool              gDTMF_IsGroupCall;
 DTMF_ReplyState_t gDTMF_ReplyState;
 
 #ifdef ENABLE_DTMF_CALLING
+// Received digits are matched incrementally (shift-and): bit i of a state is
+// set while the last i + 1 digits equal the first i + 1 characters of the
+// pattern, so a digit costs one shift and one AND per pattern whatever the
+// code lengths. Patterns longer than the 16 digit history never match, as
+// before.
+enum {
+    MATCH_KILL = 0,     // ANI + separator + kill code
+    MATCH_REVIVE,       // ANI + separator + revive code
+    MATCH_ACK,          // "AB"
+    MATCH_REPLY,        // called ID + separator + "AAAAA"
+    MATCH_CALL,         // ANI + separator + caller ID
+    MATCH_COUNT
+};
+
+#define DTMF_WILDCARD   '?'
+
+typedef struct {
+    uint16_t Mask[16];  // per DTMF symbol, positions it may take
+    uint16_t Group;     // positions where the group call code is a real digit
+    uint8_t  Length;
+} DTMF_Pattern_t;
+
+static DTMF_Pattern_t DTMF_Patterns[MATCH_COUNT];
+static uint16_t       DTMF_MatchState[MATCH_COUNT];
+
+static char           DTMF_RX_Ring[16];
+static uint8_t        DTMF_RX_Head;
+
+static char           DTMF_ContactIDs[MAX_DTMF_CONTACTS][3];
+static char           DTMF_ContactNames[MAX_DTMF_CONTACTS][8];
+static uint8_t        DTMF_ContactCount;
+
+static int DTMF_GetSymbol(const char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'D') return c - 'A' + 10;
+    if (c == '*')             return 14;
+    if (c == '#')             return 15;
+    return -1;
+}
+
+static void DTMF_CompilePattern(DTMF_Pattern_t *pPattern, const char *pTemplate, const bool bCheckGroup)
+{
+    const unsigned int Length = strlen(pTemplate);
+    const int          Group  = DTMF_GetSymbol(gEeprom.DTMF_GROUP_CALL_CODE);
+
+    memset(pPattern, 0, sizeof(*pPattern));
+
+    if (Length == 0 || Length > sizeof(DTMF_RX_Ring))
+        return;
+
+    for (unsigned int i = 0; i < Length; i++)
+    {
+        const uint16_t Bit    = 1u << i;
+        const int      Symbol = DTMF_GetSymbol(pTemplate[i]);
+
+        if (pTemplate[i] == DTMF_WILDCARD)
+        {
+            for (unsigned int s = 0; s < 16; s++)
+                pPattern->Mask[s] |= Bit;
+            pPattern->Group |= Bit;
+        }
+        else if (Symbol >= 0)
+        {
+            pPattern->Mask[Symbol] |= Bit;
+            if (Symbol == Group)
+                pPattern->Group |= Bit;
+        }
+    }
+
+    // a received group call code stands in for any digit
+    if (bCheckGroup && Group >= 0)
+        pPattern->Mask[Group] = 0xFFFF;
+
+    pPattern->Length = Length;
+}
+
+// pFirst + separator + pSecond, the codes in gEeprom need not be terminated
+static void DTMF_BuildTemplate(char *pOut, const char *pFirst, const unsigned int FirstSize, const char *pSecond)
+{
+    unsigned int Length = 0;
+
+    while (Length < FirstSize && pFirst[Length] != 0)
+    {
+        pOut[Length] = pFirst[Length];
+        Length++;
+    }
+
+    pOut[Length++] = gEeprom.DTMF_SEPARATE_CODE;
+
+    for (unsigned int i = 0; i < 8 && pSecond[i] != 0; i++)
+        pOut[Length++] = pSecond[i];
+
+    pOut[Length] = 0;
+}
+
+void DTMF_CompileMatcher(void)
+{
+    char String[40];
+
+    DTMF_BuildTemplate(String, gEeprom.ANI_DTMF_ID, sizeof(gEeprom.ANI_DTMF_ID), gEeprom.KILL_CODE);
+    DTMF_CompilePattern(&DTMF_Patterns[MATCH_KILL], String, true);
+
+    DTMF_BuildTemplate(String, gEeprom.ANI_DTMF_ID, sizeof(gEeprom.ANI_DTMF_ID), gEeprom.REVIVE_CODE);
+    DTMF_CompilePattern(&DTMF_Patterns[MATCH_REVIVE], String, true);
+
+    DTMF_CompilePattern(&DTMF_Patterns[MATCH_ACK], "AB", true);
+
+    DTMF_BuildTemplate(String, gDTMF_String, sizeof(gDTMF_String), "AAAAA");
+    DTMF_CompilePattern(&DTMF_Patterns[MATCH_REPLY], String, false);
+
+    DTMF_BuildTemplate(String, gEeprom.ANI_DTMF_ID, sizeof(gEeprom.ANI_DTMF_ID), "???");
+    DTMF_CompilePattern(&DTMF_Patterns[MATCH_CALL], String, true);
+
+    // contact lookups run on every redraw during a call, keep the IDs in RAM
+    for (DTMF_ContactCount = 0; DTMF_ContactCount < MAX_DTMF_CONTACTS; DTMF_ContactCount++)
+    {
+        char Contact[16];
+        if (!DTMF_GetContact(DTMF_ContactCount, Contact))
+            break;
+        memcpy(DTMF_ContactNames[DTMF_ContactCount], Contact, 8);
+        memcpy(DTMF_ContactIDs[DTMF_ContactCount], Contact + 8, 3);
+    }
+
+    memset(DTMF_MatchState, 0, sizeof(DTMF_MatchState));
+}
+
 void DTMF_clear_RX(void)
 {
     gDTMF_RX_timeout = 0;
     gDTMF_RX_index   = 0;
     gDTMF_RX_pending = false;
-    memset(gDTMF_RX, 0, sizeof(gDTMF_RX));
+    DTMF_RX_Head     = 0;
+    memset(DTMF_MatchState, 0, sizeof(DTMF_MatchState));
+}
+
+void DTMF_PushRX(const char c)
+{
+    const int Symbol = DTMF_GetSymbol(c);
+
+    DTMF_RX_Ring[DTMF_RX_Head] = c;
+    DTMF_RX_Head = (DTMF_RX_Head + 1) % sizeof(DTMF_RX_Ring);
+    if (gDTMF_RX_index < sizeof(DTMF_RX_Ring))
+        gDTMF_RX_index++;
+
+    for (unsigned int i = 0; i < MATCH_COUNT; i++)
+        DTMF_MatchState[i] = ((DTMF_MatchState[i] << 1) | 1u) & (Symbol >= 0 ? DTMF_Patterns[i].Mask[Symbol] : 0);
+
+    gDTMF_RX_timeout = DTMF_RX_timeout_500ms;  // time till we delete it
+    gDTMF_RX_pending = true;
+}
+
+static bool DTMF_Matched(const unsigned int Pattern)
+{
+    const uint8_t Length = DTMF_Patterns[Pattern].Length;
+    return Length && (DTMF_MatchState[Pattern] & (1u << (Length - 1)));
+}
+
+// the last Length digits, oldest first
+static void DTMF_CopyRX(char *pOut, const unsigned int Length)
+{
+    unsigned int Index = (DTMF_RX_Head + sizeof(DTMF_RX_Ring) - Length) % sizeof(DTMF_RX_Ring);
+
+    for (unsigned int i = 0; i < Length; i++)
+    {
+        pOut[i] = DTMF_RX_Ring[Index];
+        Index   = (Index + 1) % sizeof(DTMF_RX_Ring);
+    }
 }
 #endif
 
@@ -149,14 +310,9 @@ bool DTMF_FindContact(const char *pContact, char *pResult)
 {
     pResult[0] = 0;
 
-    for (unsigned int i = 0; i < MAX_DTMF_CONTACTS; i++) {
-        char Contact[16];
-        if (!DTMF_GetContact(i, Contact)) {
-            return false;
-        }
-
-        if (memcmp(pContact, Contact + 8, 3) == 0) {
-            memcpy(pResult, Contact, 8);
+    for (unsigned int i = 0; i < DTMF_ContactCount; i++) {
+        if (memcmp(pContact, DTMF_ContactIDs[i], 3) == 0) {
+            memcpy(pResult, DTMF_ContactNames[i], 8);
             pResult[8] = 0;
             return true;
         }
@@ -184,22 +340,6 @@ char DTMF_GetCharacter(const unsigned int code)
     }
 }
 #ifdef ENABLE_DTMF_CALLING
-static bool CompareMessage(const char *pMsg, const char *pTemplate, const unsigned int size, const bool bCheckGroup)
-{
-    unsigned int i;
-    for (i = 0; i < size; i++)
-    {
-        if (pMsg[i] != pTemplate[i])
-        {
-            if (!bCheckGroup || pMsg[i] != gEeprom.DTMF_GROUP_CALL_CODE)
-                return false;
-            gDTMF_IsGroupCall = true;
-        }
-    }
-
-    return true;
-}
-
 DTMF_CallMode_t DTMF_CheckGroupCall(const char *pMsg, const unsigned int size)
 {
     for (unsigned int i = 0; i < size; i++)
@@ -234,9 +374,6 @@ void DTMF_Append(const char code)
 void DTMF_HandleRequest(void)
 {   // proccess the RX'ed DTMF characters
 
-    char         String[21];
-    unsigned int Offset;
-
     if (!gDTMF_RX_pending)
         return;   // nothing new received
 
@@ -254,120 +391,80 @@ void DTMF_HandleRequest(void)
 
     gDTMF_RX_pending = false;
 
-    if (gDTMF_RX_index >= 9)
-    {   // look for the KILL code
-
-        // sprintf(String, "%s%c%s", gEeprom.ANI_DTMF_ID, gEeprom.DTMF_SEPARATE_CODE, gEeprom.KILL_CODE);
-        strcpy(String, gEeprom.ANI_DTMF_ID);
-        uint8_t len = strlen(String);
-        String[len] = gEeprom.DTMF_SEPARATE_CODE;
-        strcpy(String + len + 1, gEeprom.KILL_CODE);
-
-        Offset = gDTMF_RX_index - strlen(String);
+    // look for the KILL code
+    if (DTMF_Matched(MATCH_KILL))
+    {   // bugger
 
-        if (CompareMessage(gDTMF_RX + Offset, String, strlen(String), true))
-        {   // bugger
-
-            if (gEeprom.PERMIT_REMOTE_KILL)
-            {
-                gSetting_KILLED = true;      // oooerr !
-
-                DTMF_clear_RX();
-
-                SETTINGS_SaveSettings();
+        if (gEeprom.PERMIT_REMOTE_KILL)
+        {
+            gSetting_KILLED = true;      // oooerr !
 
-                gDTMF_ReplyState = DTMF_REPLY_AB;
+            DTMF_clear_RX();
 
-                #ifdef ENABLE_FMRADIO
-                    if (gFmRadioMode)
-                    {
-                        FM_TurnOff();
-                        GUI_SelectNextDisplay(DISPLAY_MAIN);
-                    }
-                #endif
-            }
-            else
-            {
-                gDTMF_ReplyState = DTMF_REPLY_NONE;
-            }
+            SETTINGS_SaveSettings();
 
-            gDTMF_CallState = DTMF_CALL_STATE_NONE;
+            gDTMF_ReplyState = DTMF_REPLY_AB;
 
-            gUpdateDisplay  = true;
-            gUpdateStatus   = true;
-            return;
+            #ifdef ENABLE_FMRADIO
+                if (gFmRadioMode)
+                {
+                    FM_TurnOff();
+                    GUI_SelectNextDisplay(DISPLAY_MAIN);
+                }
+            #endif
+        }
+        else
+        {
+            gDTMF_ReplyState = DTMF_REPLY_NONE;
         }
-    }
-
-    if (gDTMF_RX_index >= 9)
-    {   // look for the REVIVE code
 
-        // sprintf(String, "%s%c%s", gEeprom.ANI_DTMF_ID, gEeprom.DTMF_SEPARATE_CODE, gEeprom.REVIVE_CODE);
-        strcpy(String, gEeprom.ANI_DTMF_ID);
-        uint8_t len = strlen(String);
-        String[len] = gEeprom.DTMF_SEPARATE_CODE;
-        strcpy(String + len + 1, gEeprom.REVIVE_CODE);
+        gDTMF_CallState = DTMF_CALL_STATE_NONE;
 
-        Offset = gDTMF_RX_index - strlen(String);
+        gUpdateDisplay  = true;
+        gUpdateStatus   = true;
+        return;
+    }
 
-        if (CompareMessage(gDTMF_RX + Offset, String, strlen(String), true))
-        {   // shit, we're back !
+    // look for the REVIVE code
+    if (DTMF_Matched(MATCH_REVIVE))
+    {   // shit, we're back !
 
-            gSetting_KILLED  = false;
+        gSetting_KILLED  = false;
 
-            DTMF_clear_RX();
+        DTMF_clear_RX();
 
-            SETTINGS_SaveSettings();
+        SETTINGS_SaveSettings();
 
-            gDTMF_ReplyState = DTMF_REPLY_AB;
-            gDTMF_CallState  = DTMF_CALL_STATE_NONE;
+        gDTMF_ReplyState = DTMF_REPLY_AB;
+        gDTMF_CallState  = DTMF_CALL_STATE_NONE;
 
-            gUpdateDisplay   = true;
-            gUpdateStatus    = true;
-            return;
-        }
+        gUpdateDisplay   = true;
+        gUpdateStatus    = true;
+        return;
     }
 
-    if (gDTMF_RX_index >= 2)
-    {   // look for ACK reply
-        char *pPrintStr = "AB";
-
-        Offset = gDTMF_RX_index - strlen(pPrintStr);
-
-        if (CompareMessage(gDTMF_RX + Offset, pPrintStr, strlen(pPrintStr), true)) {
-            // ends with "AB"
-
-            if (gDTMF_ReplyState != DTMF_REPLY_NONE)          // 1of11
+    // look for ACK reply
+    if (DTMF_Matched(MATCH_ACK))
+    {   // ends with "AB"
+        if (gDTMF_ReplyState != DTMF_REPLY_NONE)          // 1of11
 //          if (gDTMF_CallState != DTMF_CALL_STATE_NONE)      // 1of11
 //          if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT)  // 1of11
-            {
-                gDTMF_State = DTMF_STATE_TX_SUCC;
-                DTMF_clear_RX();
-                gUpdateDisplay = true;
-                return;
-            }
+        {
+            gDTMF_State = DTMF_STATE_TX_SUCC;
+            DTMF_clear_RX();
+            gUpdateDisplay = true;
+            return;
         }
     }
 
+    // waiting for a reply
     if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT &&
         gDTMF_CallMode  == DTMF_CALL_MODE_NOT_GROUP &&
-        gDTMF_RX_index >= 9)
-    {   // waiting for a reply
-
-        // sprintf(String, "%s%c%s", gDTMF_String, gEeprom.DTMF_SEPARATE_CODE, "AAAAA");
-        strcpy(String, gDTMF_String);
-        uint8_t len = strlen(String);
-        String[len] = gEeprom.DTMF_SEPARATE_CODE;
-        strcpy(String + len + 1, "AAAAA");
-
-        Offset = gDTMF_RX_index - strlen(String);
-
-        if (CompareMessage(gDTMF_RX + Offset, String, strlen(String), false))
-        {   // we got a response
-            gDTMF_State    = DTMF_STATE_CALL_OUT_RSP;
-            DTMF_clear_RX();
-            gUpdateDisplay = true;
-        }
+        DTMF_Matched(MATCH_REPLY))
+    {   // we got a response
+        gDTMF_State    = DTMF_STATE_CALL_OUT_RSP;
+        DTMF_clear_RX();
+        gUpdateDisplay = true;
     }
 
     if (gSetting_KILLED || gDTMF_CallState != DTMF_CALL_STATE_NONE)
@@ -375,54 +472,51 @@ void DTMF_HandleRequest(void)
         return;
     }
 
-    if (gDTMF_RX_index >= 7)
-    {   // see if we're being called
-
-        gDTMF_IsGroupCall = false;
-
-        // sprintf(String, "%s%c", gEeprom.ANI_DTMF_ID, gEeprom.DTMF_SEPARATE_CODE);
-        strcpy(String, gEeprom.ANI_DTMF_ID);
-        uint8_t len = strlen(String);
-        String[len] = gEeprom.DTMF_SEPARATE_CODE;
-        String[len + 1] = '\0';
-
-        Offset = gDTMF_RX_index - strlen(String) - 3;
+    // see if we're being called
+    if (DTMF_Matched(MATCH_CALL))
+    {   // it's for us !
+        const DTMF_Pattern_t *pPattern = &DTMF_Patterns[MATCH_CALL];
+        const unsigned int    Length   = pPattern->Length;
+        char                  Message[sizeof(DTMF_RX_Ring)];
 
-        if (CompareMessage(gDTMF_RX + Offset, String, strlen(String), true))
-        {   // it's for us !
+        DTMF_CopyRX(Message, Length);
 
-            gDTMF_CallState = DTMF_CALL_STATE_RECEIVED;
+        gDTMF_IsGroupCall = false;
+        for (unsigned int i = 0; i < Length; i++)
+            if (Message[i] == gEeprom.DTMF_GROUP_CALL_CODE && !(pPattern->Group & (1u << i)))
+                gDTMF_IsGroupCall = true;
 
-            memset(gDTMF_Callee, 0, sizeof(gDTMF_Callee));
-            memset(gDTMF_Caller, 0, sizeof(gDTMF_Caller));
-            memcpy(gDTMF_Callee, gDTMF_RX + Offset + 0, 3);
-            memcpy(gDTMF_Caller, gDTMF_RX + Offset + 4, 3);
+        gDTMF_CallState = DTMF_CALL_STATE_RECEIVED;
 
-            DTMF_clear_RX();
+        memset(gDTMF_Callee, 0, sizeof(gDTMF_Callee));
+        memset(gDTMF_Caller, 0, sizeof(gDTMF_Caller));
+        memcpy(gDTMF_Callee, Message + 0, 3);
+        memcpy(gDTMF_Caller, Message + Length - 3, 3);
 
-            gUpdateDisplay = true;
+        DTMF_clear_RX();
 
-            switch (gEeprom.DTMF_DECODE_RESPONSE)
-            {
-                case DTMF_DEC_RESPONSE_BOTH:
-                    gDTMF_DecodeRingCountdown_500ms = DTMF_decode_ring_countdown_500ms;
-                    [[fallthrough]];
-                case DTMF_DEC_RESPONSE_REPLY:
-                    gDTMF_ReplyState = DTMF_REPLY_AAAAA;
-                    break;
-                case DTMF_DEC_RESPONSE_RING:
-                    gDTMF_DecodeRingCountdown_500ms = DTMF_decode_ring_countdown_500ms;
-                    break;
-                default:
-                case DTMF_DEC_RESPONSE_NONE:
-                    gDTMF_DecodeRingCountdown_500ms = 0;
-                    gDTMF_ReplyState = DTMF_REPLY_NONE;
-                    break;
-            }
+        gUpdateDisplay = true;
 
-            if (gDTMF_IsGroupCall)
+        switch (gEeprom.DTMF_DECODE_RESPONSE)
+        {
+            case DTMF_DEC_RESPONSE_BOTH:
+                gDTMF_DecodeRingCountdown_500ms = DTMF_decode_ring_countdown_500ms;
+                [[fallthrough]];
+            case DTMF_DEC_RESPONSE_REPLY:
+                gDTMF_ReplyState = DTMF_REPLY_AAAAA;
+                break;
+            case DTMF_DEC_RESPONSE_RING:
+                gDTMF_DecodeRingCountdown_500ms = DTMF_decode_ring_countdown_500ms;
+                break;
+            default:
+            case DTMF_DEC_RESPONSE_NONE:
+                gDTMF_DecodeRingCountdown_500ms = 0;
                 gDTMF_ReplyState = DTMF_REPLY_NONE;
+                break;
         }
+
+        if (gDTMF_IsGroupCall)
+            gDTMF_ReplyState = DTMF_REPLY_NONE;
     }
 }
 #endif
@@ -89,8 +89,7 @@ void DTMF_SendEndOfTransmission(void);
 
 #ifdef ENABLE_DTMF_CALLING
 
-extern char              gDTMF_RX[17];
-extern uint8_t           gDTMF_RX_index;
+extern uint8_t           gDTMF_RX_index;    // digits held, up to 16
 extern uint8_t           gDTMF_RX_timeout;
 extern bool              gDTMF_RX_pending;
 
@@ -109,6 +108,8 @@ extern bool              gDTMF_IsTx;
 extern uint8_t           gDTMF_TxStopCountdown_500ms;
 
 void DTMF_clear_RX(void);
+void DTMF_PushRX(const char c);
+void DTMF_CompileMatcher(void);
 DTMF_CallMode_t DTMF_CheckGroupCall(const char *pDTMF, const unsigned int size);
 bool DTMF_GetContact(const int Index, char *pContact);
 bool DTMF_FindContact(const char *pContact, char *pResult);
@@ -196,6 +196,9 @@ void GENERIC_Key_PTT(bool bKeyPressed)
         // remember the DTMF string
         gDTMF_PreviousIndex = gDTMF_InputBox_Index;
         strcpy(gDTMF_String, gDTMF_InputBox);
+#ifdef ENABLE_DTMF_CALLING
+        DTMF_CompileMatcher();
+#endif
         gDTMF_ReplyState = DTMF_REPLY_ANI;
     }
 
@@ -38,6 +38,9 @@
 #if defined(ENABLE_OVERLAY)
     #include "features/sram/sram-overlay.h"
 #endif
+#ifdef ENABLE_ASYNC_FLASH
+    #include "drivers/bsp/py25q16.h"
+#endif
 #include "ui/inputbox.h"
 #include "ui/ag_menu.h"
 #include "ui/ui.h"
@@ -414,6 +417,9 @@ int MENU_GetLimits(uint8_t menu_id, int32_t *pMin, int32_t *pMax)
         case MENU_SET_OFF:
             *pMax = 120;
             break;
+        case MENU_SET_DTY:
+            *pMax = ARRAY_SIZE(gSubMenu_SET_DTY) - 1;
+            break;
 #endif
 
 #ifdef ENABLE_CUSTOM_FIRMWARE_MODS
@@ -983,6 +989,9 @@ void MENU_AcceptSetting(void)
         case MENU_SET_OFF:
             gSetting_set_off = gSubMenuSelection;
             break;
+        case MENU_SET_DTY:
+            gSetting_sleep_duty = gSubMenuSelection;
+            break;
 #endif
 
 #ifdef ENABLE_CUSTOM_FIRMWARE_MODS
@@ -1443,6 +1452,9 @@ void MENU_ShowCurrentSetting(void)
         case MENU_SET_OFF:
             gSubMenuSelection = gSetting_set_off;
             break;
+        case MENU_SET_DTY:
+            gSubMenuSelection = gSetting_sleep_duty;
+            break;
 #endif
 
 #ifdef ENABLE_CUSTOM_FIRMWARE_MODS
@@ -1838,6 +1850,9 @@ static void MENU_Key_MENU(const bool bKeyPressed, const bool bKeyHeld)
 
                         MENU_AcceptSetting();
 
+                        #ifdef ENABLE_ASYNC_FLASH
+                            PY25Q16_Flush();
+                        #endif
                         #if defined(ENABLE_OVERLAY)
                             overlay_FLASH_RebootToBootloader();
                         #else
@@ -45,6 +45,19 @@ const freq_band_table_t frequencyBandTable[] =
         [BAND6_400MHz]={.lower = 40000000,  .upper = 47000000}
 };
 
+#ifdef ENABLE_SPECTRUM_BANDS
+const freq_band_table_t serviceBandTable[] =
+{
+    [SERVICE_BAND_AIR   ]={.lower = 11800000, .upper = 13700000},
+    [SERVICE_BAND_2M    ]={.lower = 14400000, .upper = 14800000},
+    [SERVICE_BAND_MARINE]={.lower = 15600000, .upper = 16202500},
+    [SERVICE_BAND_70CM  ]={.lower = 43000000, .upper = 44000000},
+    [SERVICE_BAND_PMR446]={.lower = 44600625, .upper = 44619375},
+};
+
+static_assert(ARRAY_SIZE(serviceBandTable) == SERVICE_BAND_N_ELEM);
+#endif
+
 #ifdef ENABLE_NOAA
     const uint32_t NoaaFrequencyTable[10] =
     {
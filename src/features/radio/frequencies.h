@@ -43,6 +43,20 @@ typedef enum  {
 
 extern const freq_band_table_t frequencyBandTable[];
 
+#ifdef ENABLE_SPECTRUM_BANDS
+// service allocations used for segmented (band plan) sweeps
+typedef enum {
+    SERVICE_BAND_AIR = 0,
+    SERVICE_BAND_2M,
+    SERVICE_BAND_MARINE,
+    SERVICE_BAND_70CM,
+    SERVICE_BAND_PMR446,
+    SERVICE_BAND_N_ELEM
+} SERVICE_Band_t;
+
+extern const freq_band_table_t serviceBandTable[];
+#endif
+
 typedef enum {
 // standard steps
     STEP_2_5kHz,
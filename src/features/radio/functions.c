@@ -120,6 +120,13 @@ void FUNCTION_Foreground(const FUNCTION_Type_t PreviousFunction)
         return;
     }
 
+#if defined(ENABLE_FM_DUAL_RX)
+    // after RX the BK1080 is still running, after TX it was powered down
+    if (PreviousFunction != FUNCTION_TRANSMIT && FM_IsPlaying()) {
+        gEnableSpeaker = true;
+        AUDIO_AudioPathOn();
+    } else
+#endif
 #if defined(ENABLE_FMRADIO)
     if (gFmRadioMode)
         gFM_RestoreCountdown_10ms = fm_restore_countdown_10ms;
@@ -136,19 +143,27 @@ void FUNCTION_Foreground(const FUNCTION_Type_t PreviousFunction)
     gUpdateStatus = true;
 }
 
+#ifdef ENABLE_DEEP_SLEEP_MODE
+// Deep sleep RX duty, sleep time in RX windows (power_save1_10ms) per window.
+// 0 keeps the old BatSav x20 ratio.
+static const uint8_t SleepDuty[SLEEP_DUTY_LEN] = {0, 20, 50, 100, 200};
+#endif
+
+// How long the BK4819 stays asleep between two RX windows
+uint16_t FUNCTION_GetSleep_10ms(void)
+{
+#ifdef ENABLE_DEEP_SLEEP_MODE
+    if (gWakeUp) {
+        if (gSetting_sleep_duty > 0 && gSetting_sleep_duty < SLEEP_DUTY_LEN)
+            return SleepDuty[gSetting_sleep_duty] * power_save1_10ms;
+        return gEeprom.BATTERY_SAVE * 200; // deep sleep now indexed on BatSav
+    }
+#endif
+    return gEeprom.BATTERY_SAVE * 10;
+}
+
 void FUNCTION_PowerSave() {
-    #ifdef ENABLE_DEEP_SLEEP_MODE
-        if(gWakeUp)
-        {
-            gPowerSave_10ms = gEeprom.BATTERY_SAVE * 200; // deep sleep now indexed on BatSav
-        }
-        else
-        {
-            gPowerSave_10ms = gEeprom.BATTERY_SAVE * 10;
-        }
-    #else
-        gPowerSave_10ms = gEeprom.BATTERY_SAVE * 10;
-    #endif
+    gPowerSave_10ms = FUNCTION_GetSleep_10ms();
     gPowerSaveCountdownExpired = false;
 
     gRxIdleMode = true;
@@ -39,5 +39,6 @@ void FUNCTION_Init(void);
 void FUNCTION_Select(FUNCTION_Type_t Function);
 bool FUNCTION_IsRx();
 bool FUNCTION_IsTx(void);
+uint16_t FUNCTION_GetSleep_10ms(void);
 
 #endif
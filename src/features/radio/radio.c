@@ -28,6 +28,9 @@
 #include "features/radio/frequencies.h"
 #include "features/radio/functions.h"
 #include "apps/battery/battery.h"
+#ifdef ENABLE_FM_DUAL_RX
+    #include "apps/fm/fm.h"
+#endif
 #include "core/misc.h"
 #include "features/radio/radio.h"
 #include "features/storage/storage.h"
@@ -785,9 +788,15 @@ void RADIO_SetupRegisters(bool switchToForeground)
         }
     #endif
 
-    AUDIO_AudioPathOff();
+#ifdef ENABLE_FM_DUAL_RX
+    // retuning the BK4819 must not cut the broadcast
+    if (!FM_IsPlaying())
+#endif
+    {
+        AUDIO_AudioPathOff();
 
-    gEnableSpeaker = false;
+        gEnableSpeaker = false;
+    }
 
     BK4819_ToggleGpioOut(BK4819_GPIO6_PIN2_GREEN, false);
 
@@ -847,6 +856,11 @@ void RADIO_SetupRegisters(bool switchToForeground)
         gRxVfo->SquelchCloseGlitchThresh, gRxVfo->SquelchOpenGlitchThresh);
 
     BK4819_PickRXFilterPathBasedOnFrequency(Frequency);
+#ifdef ENABLE_FM_DUAL_RX
+    // the BK1080 is fed from the VHF LNA, keep it up while watching UHF
+    if (FM_IsPlaying())
+        BK4819_ToggleGpioOut(BK4819_GPIO4_PIN32_VHF_LNA, true);
+#endif
 
     // what does this in do ?
     BK4819_ToggleGpioOut(BK4819_GPIO0_PIN28_RX_ENABLE, true);
@@ -21,9 +21,6 @@ static const RecordDescriptor_t gEepromMap[] = {
 #include "apps/security/passcode.h"
 #include "drivers/bsp/system.h" // For KickWatchdog? No, storage.c doesn't use it yet.
 
-// Forward declaration
-void Storage_MigrateRecord(RecordID_t id);
-
 // Helper to encrypt/decrypt buffer in place using XOR with stream generated from Key + Address
 // This is a simple counter-mode style encryption to allow random access properties.
 // Key: 32 bytes from Passcode_GetSessionKey() OR CPUID.
@@ -32,36 +29,111 @@ void Storage_MigrateRecord(RecordID_t id);
 #include "helper/crypto.h"
 #include "helper/identifier.h"
 
-static uint8_t gCpuIdKey[32];
-static bool gCpuIdKeyValid = false;
+// Expanded ChaCha20 states, [0] CPUID key, [1] master key. Only the block
+// counter (address / 64) changes between accesses.
+static chacha20_ctx gKeyState[2];
+static bool         gKeyStateValid[2];
+
+// Recently used keystream blocks. Channels are 16 bytes, so walking the
+// channel list reuses each block four times.
+#define KEYSTREAM_SLOTS 4
+
+typedef struct {
+    uint32_t block;
+    uint8_t  key;
+    bool     valid;
+    uint8_t  keystream[64];
+} KeystreamSlot_t;
+
+static KeystreamSlot_t gKeystreamCache[KEYSTREAM_SLOTS];
+static uint8_t         gKeystreamVictim;
+
+static void Storage_DropKey(uint8_t key) {
+    for (uint8_t i = 0; i < KEYSTREAM_SLOTS; i++) {
+        if (gKeystreamCache[i].key == key) {
+            memset(&gKeystreamCache[i], 0, sizeof(gKeystreamCache[i]));
+        }
+    }
+    memset(&gKeyState[key], 0, sizeof(gKeyState[key]));
+    gKeyStateValid[key] = false;
+}
+
+static void Storage_SetKey(uint8_t key, const uint8_t *pKey) {
+    chacha20_init(&gKeyState[key], pKey, (const uint8_t*)"\0\0\0\0\0\0\0\0\0\0\0\0", 0);
+    gKeyStateValid[key] = true;
+}
+
+// The key words of a ChaCha20 state are the key bytes loaded little-endian
+static bool Storage_KeyMatches(uint8_t key, const uint8_t *pKey) {
+    for (uint8_t i = 0; i < 8; i++, pKey += 4) {
+        const uint32_t w = pKey[0] | ((uint32_t)pKey[1] << 8) | ((uint32_t)pKey[2] << 16) | ((uint32_t)pKey[3] << 24);
+        if (gKeyState[key].state[4 + i] != w) return false;
+    }
+    return true;
+}
+
+// Returns the key slot for an encryption type, -1 if no key is available
+static int Storage_LoadKey(StorageEnc_t enc) {
+    if (enc == ENC_CPUID) {
+        if (!gKeyStateValid[0]) {
+            uint8_t key[32];
+            Passcode_DeriveKEK("", key);
+            Storage_SetKey(0, key);
+            memset(key, 0, 32);
+        }
+        return 0;
+    }
+
+    // The master key comes and goes with lock/unlock, compare it every time;
+    // that is a few words against a full block per access before
+    uint8_t *mk = Passcode_GetMasterKey();
+    if (mk == NULL) {
+        if (gKeyStateValid[1]) Storage_DropKey(1);
+        return -1;
+    }
+
+    if (gKeyStateValid[1]) {
+        if (Storage_KeyMatches(1, mk)) return 1;
+        Storage_DropKey(1);
+    }
+
+    Storage_SetKey(1, mk);
+    return 1;
+}
+
+static const uint8_t *Storage_GetKeystream(uint8_t key, uint32_t block) {
+    for (uint8_t i = 0; i < KEYSTREAM_SLOTS; i++) {
+        KeystreamSlot_t *slot = &gKeystreamCache[i];
+        if (slot->valid && slot->key == key && slot->block == block) {
+            return slot->keystream;
+        }
+    }
+
+    KeystreamSlot_t *slot = &gKeystreamCache[gKeystreamVictim];
+    gKeystreamVictim = (gKeystreamVictim + 1) % KEYSTREAM_SLOTS;
+
+    gKeyState[key].state[12] = block;
+    chacha20_block(gKeyState[key].state, slot->keystream);
+    slot->block = block;
+    slot->key   = key;
+    slot->valid = true;
+
+    return slot->keystream;
+}
 
 static void Storage_CryptEx(RecordID_t id, uint32_t absoluteAddr, uint8_t *buffer, uint32_t len) {
     if (id >= REC_MAX) return;
     const RecordDescriptor_t *desc = &gEepromMap[id];
     if (desc->encryption == ENC_PLAIN) return;
 
-    uint8_t key[32];
-    if (desc->encryption == ENC_CPUID) {
-        if (!gCpuIdKeyValid) {
-            Passcode_DeriveKEK("", gCpuIdKey);
-            gCpuIdKeyValid = true;
-        }
-        memcpy(key, gCpuIdKey, 32);
-    } else {
-        uint8_t *mk = Passcode_GetMasterKey();
-        if (mk == NULL) return; 
-        memcpy(key, mk, 32);
-    }
-    
-    chacha20_ctx ctx;
-    uint8_t keystream[64];
+    int key = Storage_LoadKey((StorageEnc_t)desc->encryption);
+    if (key < 0) return;
+
     uint32_t currentAddr = absoluteAddr;
     uint32_t endAddr = absoluteAddr + len;
-    
-    chacha20_init(&ctx, key, (uint8_t*)"\0\0\0\0\0\0\0\0\0\0\0\0", currentAddr / 64);
 
     while (currentAddr < endAddr) {
-        chacha20_block(ctx.state, keystream);
+        const uint8_t *keystream = Storage_GetKeystream(key, currentAddr / 64);
         uint16_t blockOffset = currentAddr % 64;
         uint16_t bytes = 64 - blockOffset;
         if (currentAddr + bytes > endAddr) bytes = endAddr - currentAddr;
@@ -70,9 +142,7 @@ static void Storage_CryptEx(RecordID_t id, uint32_t absoluteAddr, uint8_t *buffe
             buffer[(currentAddr - absoluteAddr) + i] ^= keystream[blockOffset + i];
         }
         currentAddr += bytes;
-        ctx.state[12]++;
     }
-    memset(key, 0, 32);
 }
 
 static void Storage_Crypt(RecordID_t id, uint32_t offset, uint8_t *buffer, uint32_t len) {
@@ -158,10 +228,8 @@ bool Storage_WriteRecordIndexed(RecordID_t id, uint16_t index, const void *pSrc,
 #ifdef ENABLE_STORAGE_ENCRYPTION
     if (id < REC_MAX && gEepromMap[id].encryption != ENC_PLAIN) {
         if (gEepromMap[id].encryption == ENC_PASSCODE && Passcode_IsLocked() && Passcode_IsSet()) return false;
-        if (!Passcode_IsMigrated(id) && id != REC_PASSCODE) Storage_MigrateRecord(id);
+        if (!Passcode_IsMigrated(id) && !Passcode_MigrateRecords(1ULL << id)) return false;
         Storage_CryptEx(id, addr + offset, tempBuf, len);
-        Passcode_SetMigrated(id);
-        Passcode_SaveConfig();
     }
 #endif
     
@@ -227,23 +295,69 @@ uint32_t Storage_GetRecordSize(RecordID_t id) {
     return desc->size;
 }
 
-void Storage_MigrateRecord(RecordID_t id) {
+uint16_t Storage_GetIndex(RecordID_t id, uint16_t n) {
+    if (id >= REC_MAX) return 0xFFFF;
+    const RecordDescriptor_t *desc = &gEepromMap[id];
+    if (desc->type == ALLOC_DIM2) return ((n / desc->dim2.count2) << 8) | (n % desc->dim2.count2);
+    return n;
+}
+
+uint16_t Storage_GetMigrationSectors(uint64_t mask) {
+    uint16_t sectors = 0;
 #ifdef ENABLE_STORAGE_ENCRYPTION
-    if (id >= REC_MAX) return;
-    if (gEepromMap[id].encryption == ENC_PLAIN) return;
-    if (Passcode_IsMigrated(id) && id != REC_PASSCODE) return;
-    if (gEepromMap[id].encryption == ENC_PASSCODE && Passcode_IsLocked() && Passcode_IsSet()) return;
+    for (int i = 0; i < REC_MAX; i++) {
+        if (!(mask & (1ULL << i)) || gEepromMap[i].encryption == ENC_PLAIN) continue;
+        uint32_t start = Storage_GetAddress((RecordID_t)i, 0);
+        uint32_t end = start + Storage_GetCount((RecordID_t)i) * gEepromMap[i].size;
+        for (uint32_t s = start / 0x1000; s < STORAGE_MIGRATE_SECTORS && s * 0x1000 < end; s++) {
+            sectors |= 1U << s;
+        }
+    }
+#endif
+    return sectors;
+}
 
-    uint32_t totalSize = (uint32_t)Storage_GetCount(id) * Storage_GetRecordSize(id);
-    uint32_t addr = Storage_GetAddress(id, 0);
-    uint8_t buf[64];
-    for (uint32_t offset = 0; offset < totalSize; offset += 64) {
-        uint32_t slice = (totalSize - offset > 64) ? 64 : totalSize - offset;
-        PY25Q16_ReadBuffer(addr + offset, buf, slice);
-        Storage_CryptEx(id, addr + offset, buf, slice);
-        PY25Q16_WriteBuffer(addr + offset, buf, slice, false);
+void Storage_BackupSector(uint8_t n) {
+#ifdef ENABLE_STORAGE_ENCRYPTION
+    uint8_t *scratch = PY25Q16_LoadSector(STORAGE_SCRATCH_ADDR);
+    PY25Q16_ReadBuffer((uint32_t)n * 0x1000, scratch, 0x1000);
+    PY25Q16_FlushSector();
+#else
+    (void)n;
+#endif
+}
+
+void Storage_ClearBackup(void) {
+#ifdef ENABLE_STORAGE_ENCRYPTION
+    PY25Q16_SectorErase(STORAGE_SCRATCH_ADDR);
+#endif
+}
+
+void Storage_ReadBackup(RecordID_t id, void *pDest, uint16_t len) {
+    PY25Q16_ReadBuffer(STORAGE_SCRATCH_ADDR + Storage_GetAddress(id, 0) % 0x1000, pDest, len);
+}
+
+void Storage_MigrateSector(uint8_t n, uint64_t mask, bool bFromBackup) {
+#ifdef ENABLE_STORAGE_ENCRYPTION
+    uint32_t sectorAddr = (uint32_t)n * 0x1000;
+    uint8_t *sector = PY25Q16_LoadSector(sectorAddr);
+    bool changed = bFromBackup;
+
+    if (bFromBackup) PY25Q16_ReadBuffer(STORAGE_SCRATCH_ADDR, sector, 0x1000);
+
+    for (int i = 0; i < REC_MAX; i++) {
+        if (!(mask & (1ULL << i)) || gEepromMap[i].encryption == ENC_PLAIN) continue;
+        uint32_t start = Storage_GetAddress((RecordID_t)i, 0);
+        uint32_t end = start + Storage_GetCount((RecordID_t)i) * gEepromMap[i].size;
+        if (start < sectorAddr) start = sectorAddr;
+        if (end > sectorAddr + 0x1000) end = sectorAddr + 0x1000;
+        if (start >= end) continue;
+
+        Storage_CryptEx((RecordID_t)i, start, sector + (start - sectorAddr), end - start);
+        changed = true;
     }
-    Passcode_SetMigrated(id);
+
+    if (changed) PY25Q16_FlushSector();
 #endif
 }
 
@@ -324,15 +438,10 @@ void Storage_WriteBufferRaw(uint32_t addr, const void *pSrc, uint32_t len, bool
             // SECURITY: Same check as WriteRecord
             if (gEepromMap[id].encryption == ENC_PASSCODE && Passcode_IsLocked() && Passcode_IsSet()) {
                 // Skip writing this chunk
-            } else {
-                if (!Passcode_IsMigrated(id) && id != REC_PASSCODE) {
-                    Storage_MigrateRecord(id);
-                }
+            } else if (Passcode_IsMigrated(id) || Passcode_MigrateRecords(1ULL << id)) {
                 memcpy(tempBuf, pData, processLen);
                 Storage_CryptEx(id, currentAddr, tempBuf, processLen);
                 PY25Q16_WriteBuffer(currentAddr, tempBuf, processLen, Append);
-                Passcode_SetMigrated(id);
-                Passcode_SaveConfig();
             }
         } else {
             if (id != REC_MAX) {
@@ -215,6 +215,8 @@ typedef union {
         uint8_t SIGNAL_CLASSIFIER : 1;
         uint8_t SQUELCH_TAIL_ELIMINATION : 1;
         uint8_t UNUSED : 2;
+
+        uint8_t SLEEP_DUTY;
     } fields;
     uint8_t raw[10];
 } __attribute__((packed)) FLockConfig_t;
@@ -284,7 +286,9 @@ typedef union {
         uint32_t Iterations;    // KDF Iterations
         uint8_t  EncryptedMasterKey[32]; // MK encrypted with KEK
         uint64_t MigratedMask;  // Bitmask of migrated records
-        uint8_t  Reserved[43]; // Fill to 128 bytes
+        uint64_t JournalMask;   // Records of an unfinished migration, 0 = none
+        uint8_t  JournalDone[16]; // Per 4K sector: 0xFF pending, 0x5A copied to scratch, 0x00 done
+        uint8_t  Reserved[19]; // Fill to 128 bytes
     } fields;
     uint8_t raw[128];
 } __attribute__((packed)) PasscodeConfig_t;
@@ -317,10 +321,28 @@ void Storage_SectorErase(RecordID_t id);
 
 // Dynamic address resolution
 uint32_t Storage_GetAddress(RecordID_t id, uint16_t index);
+uint16_t Storage_GetCount(RecordID_t id);
+uint32_t Storage_GetRecordSize(RecordID_t id);
+// Flat element number (0..GetCount-1) to the index GetAddress expects
+uint16_t Storage_GetIndex(RecordID_t id, uint16_t n);
 
 StorageEnc_t Storage_GetEncryptionType(RecordID_t id);
-// Migration (internal use)
-void Storage_MigrateRecord(RecordID_t id);
+// Migration (internal use). Encrypted records live in the first 16 sectors.
+#define STORAGE_MIGRATE_SECTORS 16
+// Bit n set if sector n holds part of an encrypted record in mask
+uint16_t Storage_GetMigrationSectors(uint64_t mask);
+// Spare sector holding the original of the sector a migration rewrites, so
+// an erase cut short by power loss can be redone. No record lives there.
+#define STORAGE_SCRATCH_ADDR 0x00D000
+// Copies sector n to the scratch sector
+void Storage_BackupSector(uint8_t n);
+// Erases the scratch sector once no sector needs its copy any more
+void Storage_ClearBackup(void);
+// Reads record id from the scratch copy, valid while it holds its sector
+void Storage_ReadBackup(RecordID_t id, void *pDest, uint16_t len);
+// Re-encrypts the parts of the records in mask found in sector n, one erase.
+// bFromBackup starts from the scratch copy instead of the sector itself.
+void Storage_MigrateSector(uint8_t n, uint64_t mask, bool bFromBackup);
 
 #ifdef ENABLE_STORAGE_ENCRYPTION
 // Raw physical access (legacy/bridge) - Transparently handles encryption
@@ -0,0 +1,167 @@
+#include "features/storage/storage_clone.h"
+#include "features/storage/storage.h"
+#include "core/misc.h"
+#include <assert.h>
+#include <string.h>
+
+#define ENTRY_HEADER   3U
+#define NO_RECORD      0xFF
+
+// Wire order, append only
+#define CLONE_RECORDS(X) \
+    X(SETTINGS_MAIN)   \
+    X(VFO_INDICES)     \
+    X(AUDIO_SETTINGS)  \
+    X(FM_CONFIG)       \
+    X(FM_CHANNELS)     \
+    X(SETTINGS_EXTRA)  \
+    X(ANI_DTMF_ID)     \
+    X(KILL_CODE)       \
+    X(REVIVE_CODE)     \
+    X(DTMF_UP_CODE)    \
+    X(DTMF_DOWN_CODE)  \
+    X(SCAN_LIST)       \
+    X(F_LOCK)          \
+    X(CUSTOM_SETTINGS) \
+    X(MR_ATTRIBUTES)   \
+    X(VFO_DATA)        \
+    X(CHANNEL_DATA)    \
+    X(CHANNEL_NAMES)   \
+    X(DTMF_CONTACTS)   \
+    X(CUSTOM_ROGER)
+
+static const RecordID_t gCloneRecords[] = {
+#define X(name) REC_##name,
+    CLONE_RECORDS(X)
+#undef X
+};
+
+#define CLONE_RECORD_COUNT (sizeof(gCloneRecords) / sizeof(gCloneRecords[0]))
+
+// Record geometry at compile time, for the wire format limits below
+enum {
+#define X(name, enc, type, addr, size, c1, s1, c2, s2) \
+    CLONE_SIZE_##name = (size), CLONE_COUNT_##name = (c1) * ((c2) ? (c2) : 1),
+    STORAGE_RECORDS(X)
+#undef X
+};
+
+// The first index of an entry is one byte, and a record never spans chunks
+#define X(name) \
+    static_assert(CLONE_COUNT_##name <= 256, "REC_" #name " has more records than a clone entry can index"); \
+    static_assert(CLONE_SIZE_##name <= CLONE_CHUNK_SIZE - 1 - ENTRY_HEADER, "REC_" #name " does not fit a clone chunk");
+CLONE_RECORDS(X)
+#undef X
+static_assert(CLONE_RECORD_COUNT < NO_RECORD, "clone record index collides with NO_RECORD");
+
+static bool IsShipped(RecordID_t id, uint16_t n) {
+    if (id == REC_CHANNEL_DATA || id == REC_CHANNEL_NAMES) {
+        return gMR_ChannelAttributes[n].__val != 0xFF;
+    }
+    return true;
+}
+
+// Lays the stream out from the start, only chunk Chunk is read from flash.
+// The layout depends on gMR_ChannelAttributes alone, so walking it again for
+// every chunk is cheap. The stream ends at CLONE_MAX_CHUNKS, which is all
+// CLONE_WriteChunk accepts.
+static uint8_t Walk(uint8_t Chunk, uint8_t *pBuffer) {
+    uint8_t  chunk = 0;
+    uint8_t  pos   = 1;
+    uint8_t  entry = 0;
+    uint8_t  rec   = NO_RECORD;
+    uint16_t next  = 0;
+
+    if (pBuffer) memset(pBuffer, 0xFF, CLONE_CHUNK_SIZE);
+
+    for (uint8_t r = 0; r < CLONE_RECORD_COUNT; r++) {
+        const RecordID_t id    = gCloneRecords[r];
+        const uint16_t   size  = Storage_GetRecordSize(id);
+        const uint16_t   count = Storage_GetCount(id);
+
+        for (uint16_t n = 0; n < count; n++) {
+            if (!IsShipped(id, n)) continue;
+
+            // consecutive records of one kind share an entry header
+            if (rec != r || n != next || pos + size > CLONE_CHUNK_SIZE) {
+                if (pos + ENTRY_HEADER + size > CLONE_CHUNK_SIZE) {
+                    if (chunk + 1U >= CLONE_MAX_CHUNKS) goto done;
+                    chunk++;
+                    pos = 1;
+                }
+                entry = pos;
+                rec   = r;
+                pos  += ENTRY_HEADER;
+                if (pBuffer && chunk == Chunk) {
+                    pBuffer[entry]     = r;
+                    pBuffer[entry + 1] = n;
+                    pBuffer[entry + 2] = 0;
+                }
+            }
+
+            if (pBuffer && chunk == Chunk) {
+                Storage_ReadRecordIndexed(id, Storage_GetIndex(id, n), pBuffer + pos, 0, size);
+                pBuffer[entry + 2]++;
+            }
+            pos += size;
+            next = n + 1;
+        }
+    }
+
+done:
+    if (Chunk > chunk) return 0;
+    if (pBuffer) pBuffer[0] = chunk + 1;
+    return chunk + 1;
+}
+
+uint8_t CLONE_GetChunkCount(void) {
+    return Walk(0, NULL);
+}
+
+uint8_t CLONE_ReadChunk(uint8_t Chunk, uint8_t *pBuffer) {
+    return Walk(Chunk, pBuffer);
+}
+
+static void WriteRun(RecordID_t id, uint16_t first, uint8_t count, uint16_t size, const uint8_t *pData) {
+    const uint32_t start = Storage_GetAddress(id, Storage_GetIndex(id, first));
+    const uint32_t last  = Storage_GetAddress(id, Storage_GetIndex(id, first + count - 1));
+
+    // one flash write per run when the records are packed back to back
+    if (last - start == (uint32_t)(count - 1) * size) {
+        Storage_WriteRecordIndexed(id, Storage_GetIndex(id, first), pData, 0, count * size);
+        return;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        Storage_WriteRecordIndexed(id, Storage_GetIndex(id, first + i), pData + i * size, 0, size);
+    }
+}
+
+static bool ParseChunk(const uint8_t *pBuffer, bool bStore) {
+    uint16_t pos = 1;
+
+    while (pos + ENTRY_HEADER <= CLONE_CHUNK_SIZE && pBuffer[pos] != NO_RECORD) {
+        const uint8_t  r     = pBuffer[pos];
+        const uint16_t first = pBuffer[pos + 1];
+        const uint8_t  count = pBuffer[pos + 2];
+
+        if (r >= CLONE_RECORD_COUNT || count == 0) return false;
+
+        const RecordID_t id   = gCloneRecords[r];
+        const uint16_t   size = Storage_GetRecordSize(id);
+
+        pos += ENTRY_HEADER;
+        if (first + count > Storage_GetCount(id) || pos + count * size > CLONE_CHUNK_SIZE) return false;
+
+        if (bStore) WriteRun(id, first, count, size, pBuffer + pos);
+        pos += count * size;
+    }
+
+    return true;
+}
+
+bool CLONE_WriteChunk(const uint8_t *pBuffer) {
+    if (pBuffer[0] == 0 || pBuffer[0] > CLONE_MAX_CHUNKS) return false;
+    if (!ParseChunk(pBuffer, false)) return false;
+    return ParseChunk(pBuffer, true);
+}
@@ -0,0 +1,29 @@
+#ifndef STORAGE_CLONE_H
+#define STORAGE_CLONE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Record clone stream, shared by AirCopy v2 and the serial clone commands.
+//
+// The cloneable records are cut into self-contained 128 byte chunks:
+//
+//   byte 0      chunk count of the whole stream
+//   entries     [record][first index][count] then count records of data
+//   padding     0xFF up to the end of the chunk
+//
+// Record is the position in the clone table, not RecordID_t, so the wire
+// format survives changes to STORAGE_RECORDS. Channel data and names of empty
+// slots (attributes 0xFF) are not shipped; calibration, voice and passcode
+// records never leave the radio.
+
+#define CLONE_CHUNK_SIZE   128U
+#define CLONE_MAX_CHUNKS   128U
+
+uint8_t CLONE_GetChunkCount(void);
+// Fills pBuffer with chunk Chunk, returns the chunk count (0 when out of range)
+uint8_t CLONE_ReadChunk(uint8_t Chunk, uint8_t *pBuffer);
+// Stores every entry of a chunk, false if it is malformed
+bool    CLONE_WriteChunk(const uint8_t *pBuffer);
+
+#endif // STORAGE_CLONE_H
@@ -15,6 +15,7 @@
  *     limitations under the License.
  */
 
+#include <stddef.h>
 #include <string.h>
 
 #if !defined(ENABLE_OVERLAY)
@@ -57,6 +58,14 @@
     #include "features/sram/sram-overlay.h"
 #endif
 
+#ifdef ENABLE_UART_CMD_CLONE
+#include "features/storage/storage_clone.h"
+#endif
+
+#ifdef ENABLE_ASYNC_FLASH
+#include "drivers/bsp/py25q16.h"
+#endif
+
 #define UNUSED(x) (void)(x)
 
 #define DMA_INDEX(x, y, z) (((x) + (y)) % (z))
@@ -229,10 +238,139 @@ typedef struct {
         uint16_t Flags;
         uint16_t Temperature;
         uint16_t Vref;
+#ifdef ENABLE_BATTERY_MODEL
+        uint16_t RuntimeMinutes;
+        uint16_t Padding;
+#endif
     } Data;
 } REPLY_0529_t;
 #endif
 
+#ifdef ENABLE_SPECTRUM_STREAM
+/**
+ * @brief CMD_0531: Spectrum Stream Control
+ * | Offset | Type     | Name      | Description |
+ * |--------|----------|-----------|-------------|
+ * | sizeof | uint8_t  | Enable    | 0 = stop, 1 = stream every sweep |
+ * | +1     | uint8_t  | Flags     | bit0 = allow delta frames |
+ * | +2     | uint8_t  | Padding[2]| Alignment |
+ */
+typedef struct {
+    Header_t Header;
+    uint8_t  Enable;
+    uint8_t  Flags;
+    uint8_t  Padding[2];
+} CMD_0531_t;
+
+#define SPECTRUM_STREAM_FLAG_DELTA      (1u << 0)
+#define SPECTRUM_STREAM_FLAG_SEGMENTED  (1u << 1)
+
+// full frame at least every N sweeps so a host can join mid-stream
+#define SPECTRUM_STREAM_KEYFRAME    16
+
+/**
+ * @brief REPLY_0532: Spectrum Sweep (12 + N bytes payload)
+ * Sent unsolicited after each completed sweep while streaming is enabled.
+ * Levels are RSSI/2, i.e. 1 dB per LSB (dBm = Level - 160).
+ * A zero-size 0x0532 reply acknowledges CMD_0531.
+ * | Offset | Type     | Name      | Description |
+ * |--------|----------|-----------|-------------|
+ * | sizeof | uint32_t | StartFreq | First bin, 10 Hz units |
+ * | +4     | uint32_t | Step      | Bin spacing, 10 Hz units, 0 for a band plan sweep |
+ * | +8     | uint8_t  | Count     | Number of bins (1-128) |
+ * | +9     | uint8_t  | Flags     | bit0 = delta frame, bit1 = segmented: bins span several band plan segments, no linear axis |
+ * | +10    | uint8_t  | PeakIndex | Bin holding the sweep maximum |
+ * | +11    | uint8_t  | Sequence  | Sweep counter |
+ * | +12    | uint8_t[]| Data      | Full: Count levels. Delta: 16 byte changed-bin bitmap, then changed levels |
+ */
+typedef struct {
+    Header_t Header;
+    struct {
+        uint32_t StartFreq;
+        uint32_t Step;
+        uint8_t  Count;
+        uint8_t  Flags;
+        uint8_t  PeakIndex;
+        uint8_t  Sequence;
+        uint8_t  Data[128];
+    } Data;
+} REPLY_0532_t;
+#endif
+
+#ifdef ENABLE_UART_CMD_CLONE
+/**
+ * @brief CMD_0535: Read Clone Chunk
+ * | Offset | Type     | Name      | Description |
+ * |--------|----------|-----------|-------------|
+ * | sizeof | uint8_t  | Chunk     | Chunk number, 0 first |
+ * | +1     | uint8_t  | Padding[3]| Alignment |
+ * | +4     | uint32_t | Timestamp | Session ID |
+ */
+typedef struct {
+    Header_t Header;
+    uint8_t  Chunk;
+    uint8_t  Padding[3];
+    uint32_t Timestamp;
+} CMD_0535_t;
+
+/**
+ * @brief REPLY_0536: Clone Chunk (4 + 128 bytes payload)
+ * Data is a chunk of the record clone stream, see storage_clone.h. Count 0
+ * means Chunk is past the end (or the radio is locked).
+ * | Offset | Type     | Name      | Description |
+ * |--------|----------|-----------|-------------|
+ * | sizeof | uint8_t  | Chunk     | Chunk number |
+ * | +1     | uint8_t  | Count     | Chunks in the stream |
+ * | +2     | uint8_t  | Padding[2]| Alignment |
+ * | +4     | uint8_t[]| Data      | Chunk |
+ */
+typedef struct {
+    Header_t Header;
+    struct {
+        uint8_t  Chunk;
+        uint8_t  Count;
+        uint8_t  Padding[2];
+        uint8_t  Data[CLONE_CHUNK_SIZE];
+    } Data;
+} REPLY_0535_t;
+
+/**
+ * @brief CMD_0537: Write Clone Chunk
+ * Chunks can be written in any order; send 0x05DD afterwards so the radio
+ * reloads its settings.
+ * | Offset | Type     | Name      | Description |
+ * |--------|----------|-----------|-------------|
+ * | sizeof | uint8_t  | Chunk     | Chunk number, echoed back |
+ * | +1     | uint8_t  | Padding[3]| Alignment |
+ * | +4     | uint32_t | Timestamp | Session ID |
+ * | +8     | uint8_t[]| Data      | Chunk as read with CMD_0535 |
+ */
+typedef struct {
+    Header_t Header;
+    uint8_t  Chunk;
+    uint8_t  Padding[3];
+    uint32_t Timestamp;
+    uint8_t  Data[CLONE_CHUNK_SIZE];
+} CMD_0537_t;
+
+/**
+ * @brief REPLY_0538: Write Clone Chunk Acknowledgement
+ * | Offset | Type     | Name      | Description |
+ * |--------|----------|-----------|-------------|
+ * | sizeof | uint8_t  | Chunk     | Acknowledged chunk |
+ * | +1     | bool     | Ok        | false if malformed or locked |
+ * | +2     | uint8_t  | Padding[2]| Alignment |
+ */
+typedef struct {
+    Header_t Header;
+    struct {
+        uint8_t  Chunk;
+        bool     bOk;
+        uint8_t  Padding[2];
+    } Data;
+} REPLY_0537_t;
+#endif
+
 #ifndef ENABLE_CUSTOM_FIRMWARE_MODS
 /**
  * @brief CMD_052D: Security Challenge Verification
@@ -312,6 +450,17 @@ typedef union
 // static bool     bIsEncrypted = true;
 #define bIsEncrypted true
 
+#ifdef ENABLE_SPECTRUM_STREAM
+    static bool     SpectrumStream_Enabled;
+    static uint32_t SpectrumStream_Port;
+    static uint8_t  SpectrumStream_Flags;
+    static uint8_t  SpectrumStream_Sequence;
+    static uint8_t  SpectrumStream_Prev[128];
+    static uint32_t SpectrumStream_PrevStart;
+    static uint32_t SpectrumStream_PrevStep;
+    static uint8_t  SpectrumStream_PrevCount;
+#endif
+
 #ifdef ENABLE_USB
 static void SendReply_VCP(void *pReply, uint16_t Size)
 {
@@ -645,8 +794,13 @@ static void CMD_0529(uint32_t Port)
 
     // Basic stats
     Reply.Data.Voltage = gBatteryVoltageAverage * 10;
+#ifdef ENABLE_BATTERY_MODEL
+    Reply.Data.Current        = BATTERY_GetLoad_mA();
+    Reply.Data.RuntimeMinutes = BATTERY_GetRuntimeMinutes();
+#else
     Reply.Data.Current = 0;
-    Reply.Data.Percent     = BATTERY_VoltsToPercent(gBatteryVoltageAverage);
+#endif
+    Reply.Data.Percent     = BATTERY_GetPercent();
     Reply.Data.BatteryType = gEeprom.BATTERY_TYPE;
     
     // Internal Sensors (Raw ADC)
@@ -661,6 +815,191 @@ static void CMD_0529(uint32_t Port)
 }
 #endif
 
+#ifdef ENABLE_SPECTRUM_STREAM
+/**
+ * @brief CMD_0531: Start or stop spectrum sweep streaming
+ * The stream goes to the port the command arrived on; the next sweep is
+ * always a full frame. Acknowledged with an empty 0x0532 reply.
+ */
+static void CMD_0531(uint32_t Port, const uint8_t *pBuffer)
+{
+    const CMD_0531_t *pCmd = (const CMD_0531_t *)pBuffer;
+    Header_t          Reply;
+
+    SpectrumStream_Enabled   = pCmd->Enable != 0;
+    SpectrumStream_Port      = Port;
+    SpectrumStream_Flags     = pCmd->Flags;
+    SpectrumStream_Sequence  = 0;
+    SpectrumStream_PrevCount = 0;
+
+    Reply.ID   = 0x0532;
+    Reply.Size = 0;
+
+    SendReply(Port, &Reply, sizeof(Reply));
+}
+
+/**
+ * @brief Push one completed sweep to the host.
+ * A delta frame is used when enabled, the sweep geometry is unchanged and
+ * it is smaller than a full frame. If the USB endpoint is still busy with
+ * the previous frame the sweep is dropped rather than stalling the scan.
+ * A Step of 0 marks a band plan sweep and sets the segmented flag.
+ */
+void UART_SendSpectrumSweep(uint32_t StartFreq, uint32_t Step, const uint16_t *pRssi, uint8_t Count, uint8_t PeakIndex)
+{
+    REPLY_0532_t Reply;
+    uint8_t      Levels[128];
+    uint8_t      Changed = 0;
+    uint16_t     Size;
+
+    if (!SpectrumStream_Enabled || Count == 0)
+        return;
+
+#if defined(ENABLE_USB)
+    if (SpectrumStream_Port == UART_PORT_VCP && VCP_IsTxBusy())
+        return;
+#endif
+
+    if (Count > 128)
+        Count = 128;
+
+    for (uint8_t i = 0; i < Count; i++)
+    {
+        const uint16_t rssi = pRssi[i] >> 1;
+        Levels[i] = rssi > 255 ? 255 : rssi;
+    }
+
+    const bool bSameGeometry = StartFreq == SpectrumStream_PrevStart &&
+                               Step      == SpectrumStream_PrevStep  &&
+                               Count     == SpectrumStream_PrevCount;
+
+    bool bDelta = (SpectrumStream_Flags & SPECTRUM_STREAM_FLAG_DELTA) && bSameGeometry &&
+                  (SpectrumStream_Sequence % SPECTRUM_STREAM_KEYFRAME) != 0;
+
+    if (bDelta)
+    {
+        for (uint8_t i = 0; i < Count; i++)
+            if (Levels[i] != SpectrumStream_Prev[i])
+                Changed++;
+
+        // bitmap + changed values must beat the plain frame
+        bDelta = (16u + Changed) < Count;
+    }
+
+    Reply.Header.ID       = 0x0532;
+    Reply.Data.StartFreq  = StartFreq;
+    Reply.Data.Step       = Step;
+    Reply.Data.Sequence   = SpectrumStream_Sequence;
+    Reply.Data.Count      = Count;
+    Reply.Data.PeakIndex  = PeakIndex < Count ? PeakIndex : 0;
+
+    if (bDelta)
+    {
+        uint8_t *pOut = Reply.Data.Data + 16;
+
+        memset(Reply.Data.Data, 0, 16);
+        for (uint8_t i = 0; i < Count; i++)
+        {
+            if (Levels[i] != SpectrumStream_Prev[i])
+            {
+                Reply.Data.Data[i >> 3] |= 1u << (i & 7);
+                *pOut++ = Levels[i];
+            }
+        }
+        Reply.Data.Flags = SPECTRUM_STREAM_FLAG_DELTA;
+        Size = 16 + Changed;
+    }
+    else
+    {
+        memcpy(Reply.Data.Data, Levels, Count);
+        Reply.Data.Flags = 0;
+        Size = Count;
+    }
+
+    if (Step == 0)
+        Reply.Data.Flags |= SPECTRUM_STREAM_FLAG_SEGMENTED;
+
+    Size += offsetof(REPLY_0532_t, Data.Data) - sizeof(Header_t);
+    Reply.Header.Size = Size;
+
+    memcpy(SpectrumStream_Prev, Levels, Count);
+    SpectrumStream_PrevStart = StartFreq;
+    SpectrumStream_PrevStep  = Step;
+    SpectrumStream_PrevCount = Count;
+    SpectrumStream_Sequence++;
+
+    SendReply(SpectrumStream_Port, &Reply, Size + sizeof(Header_t));
+}
+#endif
+
+#ifdef ENABLE_UART_CMD_CLONE
+static uint32_t GetTimestamp(uint32_t Port)
+{
+#if defined(ENABLE_UART)
+    if (Port == UART_PORT_UART) return UART_Timestamp;
+#endif
+#if defined(ENABLE_USB)
+    if (Port == UART_PORT_VCP) return VCP_Timestamp;
+#endif
+    return 0;
+}
+
+/**
+ * @brief CMD_0535: Read one chunk of the record clone stream
+ * Empty channels are left out, so a host fetches Count chunks instead of
+ * the whole legacy EEPROM image.
+ */
+static void CMD_0535(uint32_t Port, const uint8_t *pBuffer)
+{
+    const CMD_0535_t *pCmd = (const CMD_0535_t *)pBuffer;
+    REPLY_0535_t      Reply;
+
+    if (pCmd->Timestamp != GetTimestamp(Port))
+        return;
+
+    gSerialConfigCountDown_500ms = 12; // 6 sec
+
+    memset(&Reply, 0xFF, sizeof(Reply));
+    Reply.Header.ID   = 0x0536;
+    Reply.Header.Size = sizeof(Reply.Data);
+    Reply.Data.Chunk  = pCmd->Chunk;
+    Reply.Data.Count  = 0;
+
+    if (!(bHasCustomAesKey && gIsLocked))
+    {
+        Reply.Data.Count = CLONE_ReadChunk(pCmd->Chunk, Reply.Data.Data);
+    }
+
+    SendReply(Port, &Reply, sizeof(Reply));
+}
+
+/**
+ * @brief CMD_0537: Store one chunk of the record clone stream
+ */
+static void CMD_0537(uint32_t Port, const uint8_t *pBuffer)
+{
+    const CMD_0537_t *pCmd = (const CMD_0537_t *)pBuffer;
+    REPLY_0537_t      Reply;
+
+    if (pCmd->Timestamp != GetTimestamp(Port))
+        return;
+
+    gSerialConfigCountDown_500ms = 12; // 6 sec
+
+    memset(&Reply, 0, sizeof(Reply));
+    Reply.Header.ID   = 0x0538;
+    Reply.Header.Size = sizeof(Reply.Data);
+    Reply.Data.Chunk  = pCmd->Chunk;
+
+    if (!(bHasCustomAesKey && gIsLocked))
+    {
+        Reply.Data.bOk = CLONE_WriteChunk(pCmd->Data);
+    }
+
+    SendReply(Port, &Reply, sizeof(Reply));
+}
+#endif
+
 #ifndef ENABLE_CUSTOM_FIRMWARE_MODS
 /**
  * @brief CMD_052D: Handle Security Challenge Response
@@ -1047,6 +1386,22 @@ void UART_HandleCommand(uint32_t Port)
             break;
 #endif
 
+#ifdef ENABLE_SPECTRUM_STREAM
+        case 0x0531:
+            CMD_0531(Port, pUART_Command->Buffer);
+            break;
+#endif
+
+#ifdef ENABLE_UART_CMD_CLONE
+        case 0x0535:
+            CMD_0535(Port, pUART_Command->Buffer);
+            break;
+
+        case 0x0537:
+            CMD_0537(Port, pUART_Command->Buffer);
+            break;
+#endif
+
 #ifdef ENABLE_EXTRA_UART_CMD
         case 0x052F:
             CMD_052F(Port, pUART_Command->Buffer);
@@ -1054,6 +1409,9 @@ void UART_HandleCommand(uint32_t Port)
 #endif
 
         case 0x05DD: // reset
+            #ifdef ENABLE_ASYNC_FLASH
+                PY25Q16_Flush();
+            #endif
             #if defined(ENABLE_OVERLAY)
                 overlay_FLASH_RebootToBootloader();
             #else
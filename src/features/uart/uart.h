@@ -19,6 +19,7 @@
 #define APP_UART_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 enum
 {
@@ -33,5 +34,9 @@ enum
 bool UART_IsCommandAvailable(uint32_t Port);
 void UART_HandleCommand(uint32_t Port);
 
+#ifdef ENABLE_SPECTRUM_STREAM
+void UART_SendSpectrumSweep(uint32_t StartFreq, uint32_t Step, const uint16_t *pRssi, uint8_t Count, uint8_t PeakIndex);
+#endif
+
 #endif
 
@@ -14,35 +14,50 @@ static inline uint32_t load32_le(const uint8_t *s) {
     return s[0] | (s[1] << 8) | (s[2] << 16) | (s[3] << 24);
 }
 
-// Helper: Quarter Round
-static void chacha20_quarter_round(uint32_t *x, int a, int b, int c, int d) {
-    x[a] += x[b]; x[d] = rotl32(x[d] ^ x[a], 16);
-    x[c] += x[d]; x[b] = rotl32(x[b] ^ x[c], 12);
-    x[a] += x[b]; x[d] = rotl32(x[d] ^ x[a], 8);
-    x[c] += x[d]; x[b] = rotl32(x[b] ^ x[c], 7);
-}
+// Quarter round on named words so the compiler keeps the working state in
+// registers and stack slots with fixed offsets instead of indexing an array
+#define CHACHA20_QR(a, b, c, d) do {            \
+    a += b; d = rotl32(d ^ a, 16);              \
+    c += d; b = rotl32(b ^ c, 12);              \
+    a += b; d = rotl32(d ^ a, 8);               \
+    c += d; b = rotl32(b ^ c, 7);               \
+} while (0)
 
 void chacha20_block(uint32_t *state, uint8_t *keystream) {
-    uint32_t x[16];
-    memcpy(x, state, 64);
+    uint32_t x0  = state[0],  x1  = state[1],  x2  = state[2],  x3  = state[3];
+    uint32_t x4  = state[4],  x5  = state[5],  x6  = state[6],  x7  = state[7];
+    uint32_t x8  = state[8],  x9  = state[9],  x10 = state[10], x11 = state[11];
+    uint32_t x12 = state[12], x13 = state[13], x14 = state[14], x15 = state[15];
 
     for (int i = 0; i < 10; i++) {
         // Column rounds
-        chacha20_quarter_round(x, 0, 4, 8, 12);
-        chacha20_quarter_round(x, 1, 5, 9, 13);
-        chacha20_quarter_round(x, 2, 6, 10, 14);
-        chacha20_quarter_round(x, 3, 7, 11, 15);
+        CHACHA20_QR(x0, x4, x8,  x12);
+        CHACHA20_QR(x1, x5, x9,  x13);
+        CHACHA20_QR(x2, x6, x10, x14);
+        CHACHA20_QR(x3, x7, x11, x15);
         // Diagonal rounds
-        chacha20_quarter_round(x, 0, 5, 10, 15);
-        chacha20_quarter_round(x, 1, 6, 11, 12);
-        chacha20_quarter_round(x, 2, 7, 8, 13);
-        chacha20_quarter_round(x, 3, 4, 9, 14);
+        CHACHA20_QR(x0, x5, x10, x15);
+        CHACHA20_QR(x1, x6, x11, x12);
+        CHACHA20_QR(x2, x7, x8,  x13);
+        CHACHA20_QR(x3, x4, x9,  x14);
     }
 
-    for (int i = 0; i < 16; i++) {
-        uint32_t result = x[i] + state[i];
-        store32_le(keystream + (i * 4), result);
-    }
+    store32_le(keystream +  0, x0  + state[0]);
+    store32_le(keystream +  4, x1  + state[1]);
+    store32_le(keystream +  8, x2  + state[2]);
+    store32_le(keystream + 12, x3  + state[3]);
+    store32_le(keystream + 16, x4  + state[4]);
+    store32_le(keystream + 20, x5  + state[5]);
+    store32_le(keystream + 24, x6  + state[6]);
+    store32_le(keystream + 28, x7  + state[7]);
+    store32_le(keystream + 32, x8  + state[8]);
+    store32_le(keystream + 36, x9  + state[9]);
+    store32_le(keystream + 40, x10 + state[10]);
+    store32_le(keystream + 44, x11 + state[11]);
+    store32_le(keystream + 48, x12 + state[12]);
+    store32_le(keystream + 52, x13 + state[13]);
+    store32_le(keystream + 56, x14 + state[14]);
+    store32_le(keystream + 60, x15 + state[15]);
 }
 
 void chacha20_init(chacha20_ctx *ctx, const uint8_t *key, const uint8_t *nonce, uint32_t counter) {
@@ -37,7 +37,7 @@ static void rng_mix_entropy(void) {
     // 2. ADC Noise (Thermal/Quantization)
     static uint8_t ch = 0;
     uint32_t ch_list[] = {LL_ADC_CHANNEL_TEMPSENSOR, LL_ADC_CHANNEL_VREFINT, LL_ADC_CHANNEL_1_3VCCA};
-    entropy ^= (ADC_ReadChannel(ch_list[ch]) << 16); // Move ADC noise to high word
+    entropy ^= (ADC_ReadChannelRaw(ch_list[ch]) << 16); // Move ADC noise to high word
     ch = (ch + 1) % 3;
     
     // 3. Clock Jitter
@@ -1,10 +1,11 @@
 #include "ag_graphics.h"
-#include "fonts/NumbersStepanv3.h"
-#include "fonts/NumbersStepanv4.h"
-#include "fonts/TomThumb.h"
-#include "fonts/muHeavy8ptBold.h"
-#include "fonts/muMatrix8ptRegular.h"
-#include "fonts/symbols.h"
+// Page-layout glyphs generated from fonts/*.h by toolchain/font_atlas.py
+#include "fonts/paged/NumbersStepanv3.h"
+#include "fonts/paged/NumbersStepanv4.h"
+#include "fonts/paged/TomThumb.h"
+#include "fonts/paged/muHeavy8ptBold.h"
+#include "fonts/paged/muMatrix8ptRegular.h"
+#include "fonts/paged/symbols.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -75,14 +76,38 @@ static void AG_DrawALine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
   }
 }
 
+// Screen page p (8 pixel rows, LSB on top): 0 is the status line, 1..7 the
+// frame buffer
+static uint8_t *AG_Page(int16_t p) {
+  if (p < 0 || p > FRAME_LINES)
+    return NULL;
+  return p == 0 ? gStatusLine : gFrameBuffer[p - 1];
+}
+
+static void AG_Span(uint8_t *p, int16_t w, uint8_t m, Color c) {
+  switch (c) {
+  case C_CLEAR:
+    m = ~m;
+    while (w--)
+      *p++ &= m;
+    break;
+  case C_FILL:
+    while (w--)
+      *p++ |= m;
+    break;
+  default:
+    while (w--)
+      *p++ ^= m;
+    break;
+  }
+}
+
 void AG_DrawVLine(int16_t x, int16_t y, int16_t h, Color c) {
-  if (h)
-    AG_DrawALine(x, y, x, y + h - 1, c);
+  AG_FillRect(x, y, 1, h, c);
 }
 
 void AG_DrawHLine(int16_t x, int16_t y, int16_t w, Color c) {
-  if (w)
-    AG_DrawALine(x, y, x + w - 1, y, c);
+  AG_FillRect(x, y, w, 1, c);
 }
 
 void AG_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, Color c) {
@@ -105,27 +130,94 @@ void AG_DrawRect(int16_t x, int16_t y, int16_t w, int16_t h, Color c) {
   AG_DrawVLine(x + w - 1, y, h, c);
 }
 
+// Whole pages at a time: one masked byte per column for the partial top and
+// bottom pages, full bytes in between
 void AG_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, Color c) {
-  for (int16_t i = x, e = x + w; i < e; i++)
-    AG_DrawVLine(i, y, h, c);
+  if (w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  if (h < 0) {
+    y += h + 1;
+    h = -h;
+  }
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > LCD_WIDTH)
+    w = LCD_WIDTH - x;
+  if (y + h > LCD_HEIGHT)
+    h = LCD_HEIGHT - y;
+  if (w <= 0 || h <= 0)
+    return;
+
+  int16_t y1 = y + h - 1;
+  int16_t p0 = y >> 3, p1 = y1 >> 3;
+  uint8_t top = 0xFF << (y & 7);
+  uint8_t bottom = 0xFF >> (7 - (y1 & 7));
+
+  for (int16_t p = p0; p <= p1; p++) {
+    uint8_t m = 0xFF;
+    if (p == p0)
+      m &= top;
+    if (p == p1)
+      m &= bottom;
+    AG_Span(AG_Page(p) + x, w, m, c);
+  }
+}
+
+void AG_DrawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t w,
+                   uint8_t h, Color c) {
+  const uint8_t pages = (h + 7) >> 3;
+  const uint8_t shift = y & 7;
+
+  for (uint8_t sp = 0; sp < pages; sp++) {
+    const uint8_t *src = bitmap + sp * w;
+    uint8_t last = 0xFF;
+    if (sp == pages - 1 && (h & 7))
+      last = 0xFF >> (8 - (h & 7));
+
+    // a source page straddles two screen pages unless y is page aligned
+    uint8_t *hi = AG_Page((y >> 3) + sp);
+    uint8_t *lo = shift ? AG_Page((y >> 3) + sp + 1) : NULL;
+    if (!hi && !lo)
+      continue;
+
+    for (int16_t col = 0; col < w; col++) {
+      int16_t dx = x + col;
+      if (dx < 0 || dx >= LCD_WIDTH)
+        continue;
+      uint16_t bits = (uint16_t)(src[col] & last) << shift;
+      if (hi && (bits & 0xFF))
+        AG_Span(hi + dx, 1, bits & 0xFF, c);
+      if (lo && (bits >> 8))
+        AG_Span(lo + dx, 1, bits >> 8, c);
+    }
+  }
 }
 
 static void m_putchar(int16_t x, int16_t y, uint8_t c, Color col, uint8_t sx,
                       uint8_t sy, const GFXfont *f) {
   const GFXglyph *g = &f->glyph[c - f->first];
   const uint8_t *b = f->bitmap + g->bitmapOffset;
-  uint8_t w = g->width, h = g->height, bits = 0, bit = 0;
+  uint8_t w = g->width, h = g->height;
   int8_t xo = g->xOffset, yo = g->yOffset;
 
+  // glyphs are stored in page layout, unscaled text is a straight blit
+  if (sx == 1 && sy == 1) {
+    AG_DrawBitmap(x + xo, y + yo, b, w, h, col);
+    return;
+  }
+
   for (uint8_t yy = 0; yy < h; yy++) {
-    for (uint8_t xx = 0; xx < w; xx++, bits <<= 1) {
-      if (!(bit++ & 7))
-        bits = *b++;
-      if (bits & 0x80) {
-        (sx == 1 && sy == 1)
-            ? AG_PutPixel(x + xo + xx, y + yo + yy, col)
-            : AG_FillRect(x + (xo + xx) * sx, y + (yo + yy) * sy, sx, sy, col);
-      }
+    for (uint8_t xx = 0; xx < w; xx++) {
+      if (b[(yy >> 3) * w + xx] & (1 << (yy & 7)))
+        AG_FillRect(x + (xo + xx) * sx, y + (yo + yy) * sy, sx, sy, col);
     }
   }
 }
@@ -196,8 +288,10 @@ void write_char(uint8_t c, uint8_t tsx, uint8_t tsy, bool wrap, Color col,
 static void printStr(const GFXfont *f, uint8_t x, uint8_t y, Color col,
                      TextPos pos, const char *str) {
   int16_t x1, y1;
-  uint16_t w, h;
-  getTextBounds(str, x, y, &x1, &y1, &w, &h, f);
+  uint16_t w = 0, h;
+  // left aligned text needs no width, skip the extra pass over the string
+  if (pos != POS_L)
+    getTextBounds(str, x, y, &x1, &y1, &w, &h, f);
   cursor.x = pos == POS_C ? x - (w >> 1) : pos == POS_R ? x - w : x;
   cursor.y = y;
   for (const char *p = str; *p; p++)
@@ -34,6 +34,10 @@ void AG_DrawHLine(int16_t x, int16_t y, int16_t w, Color color);
 void AG_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, Color color);
 void AG_DrawRect(int16_t x, int16_t y, int16_t w, int16_t h, Color color);
 void AG_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, Color color);
+// 1-bpp bitmap in LCD page layout: ceil(h / 8) rows of w column bytes, LSB on
+// top. Set bits are drawn with color, clear bits leave the screen untouched.
+void AG_DrawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t w,
+                   uint8_t h, Color color);
 
 void AG_PrintSmall(uint8_t x, uint8_t y, const char *str);
 void AG_PrintMedium(uint8_t x, uint8_t y, const char *str);
@@ -17,6 +17,24 @@ static bool is_pressed = false;
 
 static void (*renderFn)(uint8_t x, uint8_t y, const char *str);
 
+// What is on the frame buffer from the last render, rows that still match it
+// are not drawn again.
+#define MENU_MAX_ROWS 16
+
+static struct {
+  const Menu *menu;
+  uint16_t offset;
+  uint16_t num_items;
+  uint16_t i;
+  uint8_t thumb_y;
+  bool editing;
+  bool pressed;
+  bool valid;
+} drawn;
+
+static uint16_t dirty_rows;  // visible rows to redraw, bit 0 = top row
+static uint8_t dirty_lines;  // gFrameBuffer lines touched since the last blit
+
 extern bool gUpdateStatus;
 
 #ifndef MIN
@@ -59,6 +77,8 @@ static void renderItem(uint16_t index, uint8_t i) {
 }
 
 static void init() {
+  AG_MENU_Invalidate();
+
   if (active_menu->y < MENU_Y)
     active_menu->y = MENU_Y;
 
@@ -98,9 +118,11 @@ void AG_MENU_Init(Menu *main_menu) {
 void AG_MENU_Deinit(void) {
   active_menu = NULL;
   is_pressed = false;
+  AG_MENU_Invalidate();
 }
 
 void AG_MENU_Reset(void) {
+  AG_MENU_Invalidate();
   active_menu = NULL;
   menu_stack_top = 0;
   is_pressed = false;
@@ -113,6 +135,38 @@ static int32_t ConvertDomain(int32_t aValue, int32_t aMin, int32_t aMax, int32_t
    return bMin + (aValue - aMin) * (bMax - bMin) / (aMax - aMin);
 }
 
+void AG_MENU_Invalidate(void) {
+  drawn.valid = false;
+}
+
+void AG_MENU_InvalidateItem(uint16_t index) {
+  if (drawn.valid && index >= drawn.offset && index - drawn.offset < MENU_MAX_ROWS)
+    dirty_rows |= 1U << (index - drawn.offset);
+}
+
+static void markLines(uint8_t y, uint8_t h) {
+  for (uint8_t page = y >> 3; page <= (y + h - 1) >> 3; page++) {
+    if (page >= 1 && page <= FRAME_LINES)
+      dirty_lines |= 1U << (page - 1);
+  }
+}
+
+static void drawHighlight(uint16_t idx, uint8_t y, uint8_t ex) {
+  const uint8_t rw = ex - 4 - active_menu->x;
+
+  if (active_menu->items && active_menu->items[idx].type == M_ITEM_SELECT) {
+    if (is_editing) {
+      AG_FillRect(active_menu->x, y, ex - 4, active_menu->itemHeight, C_INVERT);
+    } else {
+      AG_DrawRect(active_menu->x, y, ex - 4, active_menu->itemHeight, C_FILL);
+    }
+  } else if (active_menu->items && is_pressed) {
+    AG_DrawRect(active_menu->x, y, rw, active_menu->itemHeight, C_FILL);
+  } else {
+    AG_FillRect(active_menu->x, y, rw, active_menu->itemHeight, C_INVERT);
+  }
+}
+
 void AG_MENU_Render(void) {
   if (!active_menu)
     return;
@@ -123,7 +177,6 @@ void AG_MENU_Render(void) {
   // Rigorous bounds checking
   if (active_menu->num_items == 0) {
       active_menu->i = 0;
-      AG_PrintSmallEx(LCD_WIDTH/2, active_menu->y + 10, POS_C, C_FILL, "(empty)");
   } else if (active_menu->i >= active_menu->num_items) {
       active_menu->i = active_menu->num_items - 1;
   }
@@ -140,44 +193,52 @@ void AG_MENU_Render(void) {
      effective_offset = 0;
 
   const uint16_t visible = MIN(active_menu->num_items, itemsShow);
-  
+
   const uint8_t ex = getMenuRightEdge();
 
-  AG_FillRect(active_menu->x, active_menu->y, active_menu->width,
-           active_menu->height, C_CLEAR);
-           
+  // Scrolling moves every row, on_tick may change any of them
+  const bool full = !drawn.valid || drawn.menu != active_menu ||
+                    drawn.offset != effective_offset ||
+                    drawn.num_items != active_menu->num_items ||
+                    active_menu->on_tick || visible > MENU_MAX_ROWS;
+
+  if (full) {
+    AG_FillRect(active_menu->x, active_menu->y, active_menu->width,
+             active_menu->height, C_CLEAR);
+    markLines(active_menu->y, active_menu->height);
+    dirty_rows = 0xFFFF;
+
+    if (active_menu->num_items == 0)
+      AG_PrintSmallEx(LCD_WIDTH/2, active_menu->y + 10, POS_C, C_FILL, "(empty)");
+  } else {
+    if (drawn.i != active_menu->i) {
+      AG_MENU_InvalidateItem(drawn.i);
+      AG_MENU_InvalidateItem(active_menu->i);
+    } else if (drawn.editing != is_editing || drawn.pressed != is_pressed) {
+      AG_MENU_InvalidateItem(active_menu->i);
+    }
+  }
+
   for (uint16_t i = 0; i < visible; ++i) {
     uint16_t idx = i + effective_offset;
     if (idx >= active_menu->num_items)
       break;
 
-    const bool isActive = idx == active_menu->i;
+    if (!(dirty_rows & (1U << i)))
+      continue;
+
     const uint8_t y = active_menu->y + i * active_menu->itemHeight;
 
+    if (!full) {
+      AG_FillRect(active_menu->x, y, ex - 4 - active_menu->x,
+                  active_menu->itemHeight, C_CLEAR);
+      markLines(y, active_menu->itemHeight);
+    }
+
     active_menu->render_item(idx, i);
 
-    if (isActive) {
-      if (active_menu->items) {
-          const MenuItem *item = &active_menu->items[idx];
-          if (item->type == M_ITEM_SELECT) {
-              if (is_editing) {
-                  AG_FillRect(active_menu->x, y, ex - 4, active_menu->itemHeight, C_INVERT);
-              } else {
-                  AG_DrawRect(active_menu->x, y, ex - 4, active_menu->itemHeight, C_FILL);
-              }
-          } else {
-              const uint8_t rw = ex - 4 - active_menu->x;
-              if (is_pressed) {
-                  AG_DrawRect(active_menu->x, y, rw, active_menu->itemHeight, C_FILL);
-              } else {
-                  AG_FillRect(active_menu->x, y, rw, active_menu->itemHeight, C_INVERT);
-              }
-          }
-      } else {
-          const uint8_t rw = ex - 4 - active_menu->x;
-          AG_FillRect(active_menu->x, y, rw, active_menu->itemHeight, C_INVERT);
-      }
-    }
+    if (idx == active_menu->i)
+      drawHighlight(idx, y, ex);
   }
 
   // Scrollbar
@@ -191,8 +252,34 @@ void AG_MENU_Render(void) {
                                    active_menu->y, ey - 3);
   }
 
-  AG_DrawVLine(ex - 2, active_menu->y, active_menu->height, C_FILL);
-  AG_FillRect(ex - 3, y_pos, 3, 3, C_FILL);
+  if (full) {
+    AG_DrawVLine(ex - 2, active_menu->y, active_menu->height, C_FILL);
+    AG_FillRect(ex - 3, y_pos, 3, 3, C_FILL);
+  } else if (drawn.thumb_y != y_pos) {
+    AG_FillRect(ex - 3, drawn.thumb_y, 3, 3, C_CLEAR);
+    AG_DrawVLine(ex - 2, drawn.thumb_y, 3, C_FILL);
+    AG_FillRect(ex - 3, y_pos, 3, 3, C_FILL);
+    markLines(drawn.thumb_y, 3);
+    markLines(y_pos, 3);
+  }
+
+  drawn.menu = active_menu;
+  drawn.offset = effective_offset;
+  drawn.num_items = active_menu->num_items;
+  drawn.i = active_menu->i;
+  drawn.thumb_y = y_pos;
+  drawn.editing = is_editing;
+  drawn.pressed = is_pressed;
+  drawn.valid = true;
+  dirty_rows = 0;
+}
+
+void AG_MENU_Blit(void) {
+  for (uint8_t line = 0; line < FRAME_LINES; line++) {
+    if (dirty_lines & (1U << line))
+      ST7565_BlitLine(line);
+  }
+  dirty_lines = 0;
 }
 
 void AG_MENU_EnterMenu(Menu *submenu) {
@@ -265,6 +352,7 @@ bool AG_MENU_HandleInput(KEY_Code_t key, bool key_pressed, bool key_held) {
                   if (item->change_value) {
                       bool up = (key == KEY_UP || key == KEY_F || key == KEY_SIDE1);
                       item->change_value(item, up);
+                      AG_MENU_InvalidateItem(active_menu->i);
                       if (!key_held && item->setting != MENU_ROGER) AUDIO_PlayBeep(BEEP_1KHZ_60MS_OPTIONAL);
                       return true;
                   }
@@ -287,6 +375,9 @@ bool AG_MENU_HandleInput(KEY_Code_t key, bool key_pressed, bool key_held) {
   }
 
   if (!hasItems) {
+    // the menu action may change anything on screen
+    if (active_menu->action)
+      AG_MENU_Invalidate();
     if (active_menu->action &&
         active_menu->action(active_menu->i, key, key_pressed, key_held)) {
       return true;
@@ -314,17 +405,21 @@ bool AG_MENU_HandleInput(KEY_Code_t key, bool key_pressed, bool key_held) {
           AUDIO_PlayBeep(BEEP_1KHZ_60MS_OPTIONAL);
           return true;
         } else if (item->action) {
+           AG_MENU_Invalidate();
            if (item->action(item, key, key_pressed, key_held)) {
                AUDIO_PlayBeep(BEEP_1KHZ_60MS_OPTIONAL);
                return true;
            }
         } else if (item->change_value) { // Toggle (M_ITEM_ACTION with change_value)
             item->change_value(item, true);
+            AG_MENU_InvalidateItem(active_menu->i);
             AUDIO_PlayBeep(BEEP_1KHZ_60MS_OPTIONAL);
             return true;
         }
       } else if (is_pressed) {
         // Handle long press if needed (passed to action)
+        if (item->action)
+          AG_MENU_Invalidate();
         if (item->action && item->action(item, key, key_pressed, key_held)) {
             return true;
         }
@@ -340,6 +435,8 @@ bool AG_MENU_HandleInput(KEY_Code_t key, bool key_pressed, bool key_held) {
   }
   
   // Final fallthrough for other keys (UP/DOWN/F etc handled by action)
+  if (key_pressed && item->action)
+    AG_MENU_Invalidate();
   if (key_pressed && item->action && item->action(item, key, key_pressed, key_held)) {
     return true;
   }
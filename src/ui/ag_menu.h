@@ -56,7 +56,15 @@ typedef struct Menu {
 void AG_MENU_Init(Menu *main_menu);
 void AG_MENU_Deinit(void);
 void AG_MENU_Reset(void);
+// Rows are retained between renders: only rows whose selection, edit state
+// or value changed are drawn again, a scroll redraws the whole menu. Call
+// AG_MENU_Invalidate() after anything else drew over the menu area and
+// AG_MENU_InvalidateItem() when a value changes outside of AG_MENU_HandleInput.
 void AG_MENU_Render(void);
+// Sends the frame buffer lines touched by AG_MENU_Render to the display
+void AG_MENU_Blit(void);
+void AG_MENU_Invalidate(void);
+void AG_MENU_InvalidateItem(uint16_t index);
 bool AG_MENU_HandleInput(KEY_Code_t key, bool key_pressed, bool key_held);
 bool AG_MENU_Back(void);
 void AG_MENU_EnterMenu(Menu *submenu);
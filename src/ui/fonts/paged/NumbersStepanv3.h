@@ -0,0 +1,41 @@
+// Generated by toolchain/font_atlas.py from fonts/NumbersStepanv3.h, do not edit.
+// Page layout: per glyph ceil(height / 8) strips of width column bytes, LSB on top.
+#include "../../gfxfont.h"
+
+const uint8_t dig_14PageBitmaps[] PROGMEM = {
+    0x03, 0x03, 0x03, 0xFE, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF,
+    0xFE, 0x1F, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x1F, 0x00,
+    0x00, 0x0C, 0x0C, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x30, 0x3F, 0x3F, 0x3F, 0x30, 0x30, 0x00, 0x06, 0x07, 0x87, 0x83, 0xC3,
+    0xC3, 0x63, 0x7F, 0x3F, 0x1E, 0x3E, 0x3F, 0x3F, 0x31, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x06, 0x07, 0x07, 0xC3, 0xC3, 0xC3, 0xE3, 0xFF, 0xBF,
+    0x1E, 0x18, 0x38, 0x38, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x1F, 0x80,
+    0xC0, 0xE0, 0x70, 0x38, 0x1C, 0xFE, 0xFF, 0xFF, 0x00, 0x07, 0x07, 0x07,
+    0x06, 0x06, 0x06, 0x3F, 0x3F, 0x3F, 0x06, 0xFF, 0xFF, 0xFF, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0x83, 0x18, 0x38, 0x38, 0x30, 0x30, 0x30, 0x30,
+    0x3F, 0x3F, 0x1F, 0xFC, 0xFE, 0xFF, 0xC7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+    0x80, 0x1F, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x1F, 0x07,
+    0x07, 0x07, 0x03, 0x03, 0xC3, 0xF3, 0xFF, 0x3F, 0x0F, 0x00, 0x00, 0x30,
+    0x3C, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0xFF, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xFF, 0xFF, 0xBE, 0x1F, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30,
+    0x3F, 0x3F, 0x1F, 0x7E, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF, 0xFF,
+    0xFE, 0x18, 0x38, 0x38, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x1F,
+};
+
+const GFXglyph dig_14PageGlyphs[] PROGMEM = {
+    {    0,   3,   2,   4,    0,   -1}, // 0x2E '.'
+    {    3,   0,   0,   0,    0,    0}, // 0x2F '/'
+    {    3,  10,  14,  11,    0,  -13}, // 0x30 '0'
+    {   23,  10,  14,  11,    0,  -13}, // 0x31 '1'
+    {   43,  10,  14,  11,    0,  -13}, // 0x32 '2'
+    {   63,  10,  14,  11,    0,  -13}, // 0x33 '3'
+    {   83,  10,  14,  11,    0,  -13}, // 0x34 '4'
+    {  103,  10,  14,  11,    0,  -13}, // 0x35 '5'
+    {  123,  10,  14,  11,    0,  -13}, // 0x36 '6'
+    {  143,  10,  14,  11,    0,  -13}, // 0x37 '7'
+    {  163,  10,  14,  11,    0,  -13}, // 0x38 '8'
+    {  183,  10,  14,  11,    0,  -13}, // 0x39 '9'
+};
+
+const GFXfont dig_14 PROGMEM = {(uint8_t *)dig_14PageBitmaps,
+    (GFXglyph *)dig_14PageGlyphs, 0x2E, 0x39, 14};
@@ -0,0 +1,41 @@
+// Generated by toolchain/font_atlas.py from fonts/NumbersStepanv4.h, do not edit.
+// Page layout: per glyph ceil(height / 8) strips of width column bytes, LSB on top.
+#include "../../gfxfont.h"
+
+const uint8_t dig_11PageBitmaps[] PROGMEM = {
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFE, 0xFF,
+    0xFF, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFE, 0x03, 0x07, 0x07, 0x06, 0x06,
+    0x06, 0x07, 0x07, 0x03, 0x0C, 0x0C, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x06,
+    0x06, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x07, 0x87, 0xC3, 0xE3, 0x73,
+    0x3F, 0x1F, 0x0E, 0x06, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x07, 0x07, 0x33, 0x33, 0x33, 0xFF, 0xFF, 0xEE, 0x03, 0x07, 0x07,
+    0x06, 0x06, 0x06, 0x07, 0x07, 0x03, 0xC0, 0xE0, 0xF0, 0x38, 0x1C, 0xFE,
+    0xFF, 0xFF, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x07, 0x03,
+    0x3F, 0x3F, 0x3F, 0x33, 0x33, 0x33, 0xF3, 0xF3, 0xE3, 0x03, 0x07, 0x07,
+    0x06, 0x06, 0x06, 0x07, 0x07, 0x03, 0xFE, 0xFF, 0xFF, 0x33, 0x33, 0x33,
+    0xF7, 0xF7, 0xE6, 0x03, 0x07, 0x07, 0x06, 0x06, 0x06, 0x07, 0x07, 0x03,
+    0x07, 0x07, 0x07, 0x83, 0xE3, 0xF3, 0x7F, 0x1F, 0x0F, 0x00, 0x00, 0x06,
+    0x07, 0x07, 0x01, 0x00, 0x00, 0x00, 0xEE, 0xFF, 0xFF, 0x33, 0x33, 0x33,
+    0xFF, 0xFF, 0xEE, 0x03, 0x07, 0x07, 0x06, 0x06, 0x06, 0x07, 0x07, 0x03,
+    0x1E, 0x3F, 0x3F, 0x33, 0x33, 0x33, 0xFF, 0xFF, 0xFE, 0x03, 0x07, 0x07,
+    0x06, 0x06, 0x06, 0x07, 0x07, 0x03,
+};
+
+const GFXglyph dig_11PageGlyphs[] PROGMEM = {
+    {    0,   7,   2,   8,    0,   -6}, // 0x2D '-'
+    {    7,   3,   2,   4,    0,   -1}, // 0x2E '.'
+    {   10,   0,   0,   0,    0,    0}, // 0x2F '/'
+    {   10,   9,  11,  10,    0,  -10}, // 0x30 '0'
+    {   28,   7,  11,  10,    1,  -10}, // 0x31 '1'
+    {   42,   9,  11,  10,    0,  -10}, // 0x32 '2'
+    {   60,   9,  11,  10,    0,  -10}, // 0x33 '3'
+    {   78,   9,  11,  10,    0,  -10}, // 0x34 '4'
+    {   96,   9,  11,  10,    0,  -10}, // 0x35 '5'
+    {  114,   9,  11,  10,    0,  -10}, // 0x36 '6'
+    {  132,   9,  11,  10,    0,  -10}, // 0x37 '7'
+    {  150,   9,  11,  10,    0,  -10}, // 0x38 '8'
+    {  168,   9,  11,  10,    0,  -10}, // 0x39 '9'
+};
+
+const GFXfont dig_11 PROGMEM = {(uint8_t *)dig_11PageBitmaps,
+    (GFXglyph *)dig_11PageGlyphs, 0x2D, 0x39, 11};
@@ -0,0 +1,131 @@
+// Generated by toolchain/font_atlas.py from fonts/TomThumb.h, do not edit.
+// Page layout: per glyph ceil(height / 8) strips of width column bytes, LSB on top.
+#include "../../gfxfont.h"
+
+const uint8_t TomThumbPageBitmaps[] PROGMEM = {
+    0x00, 0x17, 0x03, 0x00, 0x03, 0x1F, 0x0A, 0x1F, 0x0A, 0x1F, 0x05, 0x09,
+    0x04, 0x12, 0x0F, 0x17, 0x1C, 0x03, 0x0E, 0x11, 0x11, 0x0E, 0x05, 0x02,
+    0x05, 0x02, 0x07, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 0x04,
+    0x03, 0x1E, 0x11, 0x0F, 0x02, 0x1F, 0x00, 0x19, 0x15, 0x12, 0x11, 0x15,
+    0x0A, 0x07, 0x04, 0x1F, 0x17, 0x15, 0x09, 0x1E, 0x15, 0x1D, 0x19, 0x05,
+    0x03, 0x1F, 0x15, 0x1F, 0x17, 0x15, 0x0F, 0x05, 0x08, 0x05, 0x04, 0x0A,
+    0x11, 0x05, 0x05, 0x05, 0x11, 0x0A, 0x04, 0x01, 0x15, 0x03, 0x0E, 0x15,
+    0x16, 0x1E, 0x05, 0x1E, 0x1F, 0x15, 0x0A, 0x0E, 0x11, 0x11, 0x1F, 0x11,
+    0x0E, 0x1F, 0x15, 0x15, 0x1F, 0x05, 0x05, 0x0E, 0x15, 0x1D, 0x1F, 0x04,
+    0x1F, 0x11, 0x1F, 0x11, 0x08, 0x10, 0x0F, 0x1F, 0x04, 0x1B, 0x1F, 0x10,
+    0x10, 0x1F, 0x02, 0x04, 0x02, 0x1F, 0x1F, 0x02, 0x04, 0x1F, 0x0E, 0x11,
+    0x11, 0x0E, 0x1F, 0x05, 0x02, 0x0E, 0x11, 0x09, 0x16, 0x1F, 0x0D, 0x16,
+    0x12, 0x15, 0x09, 0x01, 0x1F, 0x01, 0x1F, 0x10, 0x1F, 0x0F, 0x10, 0x0F,
+    0x1F, 0x08, 0x04, 0x08, 0x1F, 0x1B, 0x04, 0x1B, 0x03, 0x1C, 0x03, 0x19,
+    0x15, 0x13, 0x1F, 0x11, 0x11, 0x01, 0x02, 0x04, 0x11, 0x11, 0x1F, 0x02,
+    0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0D, 0x0B, 0x0E, 0x1F, 0x12,
+    0x0C, 0x06, 0x09, 0x09, 0x0C, 0x12, 0x1F, 0x06, 0x0D, 0x0B, 0x04, 0x1E,
+    0x05, 0x06, 0x15, 0x0F, 0x1F, 0x02, 0x1C, 0x1D, 0x10, 0x20, 0x1D, 0x1F,
+    0x0C, 0x12, 0x11, 0x1F, 0x10, 0x0F, 0x01, 0x0F, 0x01, 0x0E, 0x0F, 0x01,
+    0x0E, 0x06, 0x09, 0x06, 0x1F, 0x09, 0x06, 0x06, 0x09, 0x1F, 0x0E, 0x01,
+    0x01, 0x0A, 0x0F, 0x05, 0x02, 0x1F, 0x12, 0x0F, 0x08, 0x0F, 0x07, 0x08,
+    0x07, 0x07, 0x08, 0x0E, 0x08, 0x0F, 0x09, 0x06, 0x09, 0x03, 0x14, 0x0F,
+    0x0D, 0x0F, 0x0B, 0x04, 0x1B, 0x11, 0x1B, 0x11, 0x1B, 0x04, 0x02, 0x03,
+    0x01,
+};
+
+const GFXglyph TomThumbPageGlyphs[] PROGMEM = {
+    {    0,   1,   1,   4,    0,   -4}, // 0x20 ' '
+    {    1,   1,   5,   2,    0,   -4}, // 0x21 '!'
+    {    2,   3,   2,   4,    0,   -4}, // 0x22 '"'
+    {    5,   3,   5,   4,    0,   -4}, // 0x23 '#'
+    {    8,   3,   5,   4,    0,   -4}, // 0x24 '$'
+    {   11,   3,   5,   4,    0,   -4}, // 0x25 '%'
+    {   14,   3,   5,   4,    0,   -4}, // 0x26 '&'
+    {   17,   1,   2,   2,    0,   -4}, // 0x27 '''
+    {   18,   2,   5,   3,    0,   -4}, // 0x28 '('
+    {   20,   2,   5,   3,    0,   -4}, // 0x29 ')'
+    {   22,   3,   3,   4,    0,   -4}, // 0x2A '*'
+    {   25,   3,   3,   4,    0,   -3}, // 0x2B '+'
+    {   28,   2,   2,   3,    0,   -1}, // 0x2C ','
+    {   30,   3,   1,   4,    0,   -2}, // 0x2D '-'
+    {   33,   1,   1,   2,    0,    0}, // 0x2E '.'
+    {   34,   3,   5,   4,    0,   -4}, // 0x2F '/'
+    {   37,   3,   5,   4,    0,   -4}, // 0x30 '0'
+    {   40,   3,   5,   4,    0,   -4}, // 0x31 '1'
+    {   43,   3,   5,   4,    0,   -4}, // 0x32 '2'
+    {   46,   3,   5,   4,    0,   -4}, // 0x33 '3'
+    {   49,   3,   5,   4,    0,   -4}, // 0x34 '4'
+    {   52,   3,   5,   4,    0,   -4}, // 0x35 '5'
+    {   55,   3,   5,   4,    0,   -4}, // 0x36 '6'
+    {   58,   3,   5,   4,    0,   -4}, // 0x37 '7'
+    {   61,   3,   5,   4,    0,   -4}, // 0x38 '8'
+    {   64,   3,   5,   4,    0,   -4}, // 0x39 '9'
+    {   67,   1,   3,   2,    0,   -3}, // 0x3A ':'
+    {   68,   2,   4,   3,    0,   -3}, // 0x3B ';'
+    {   70,   3,   5,   4,    0,   -4}, // 0x3C '<'
+    {   73,   3,   3,   4,    0,   -3}, // 0x3D '='
+    {   76,   3,   5,   4,    0,   -4}, // 0x3E '>'
+    {   79,   3,   5,   4,    0,   -4}, // 0x3F '?'
+    {   82,   3,   5,   4,    0,   -4}, // 0x40 '@'
+    {   85,   3,   5,   4,    0,   -4}, // 0x41 'A'
+    {   88,   3,   5,   4,    0,   -4}, // 0x42 'B'
+    {   91,   3,   5,   4,    0,   -4}, // 0x43 'C'
+    {   94,   3,   5,   4,    0,   -4}, // 0x44 'D'
+    {   97,   3,   5,   4,    0,   -4}, // 0x45 'E'
+    {  100,   3,   5,   4,    0,   -4}, // 0x46 'F'
+    {  103,   3,   5,   4,    0,   -4}, // 0x47 'G'
+    {  106,   3,   5,   4,    0,   -4}, // 0x48 'H'
+    {  109,   3,   5,   4,    0,   -4}, // 0x49 'I'
+    {  112,   3,   5,   4,    0,   -4}, // 0x4A 'J'
+    {  115,   3,   5,   4,    0,   -4}, // 0x4B 'K'
+    {  118,   3,   5,   4,    0,   -4}, // 0x4C 'L'
+    {  121,   5,   5,   6,    0,   -4}, // 0x4D 'M'
+    {  126,   4,   5,   5,    0,   -4}, // 0x4E 'N'
+    {  130,   4,   5,   5,    0,   -4}, // 0x4F 'O'
+    {  134,   3,   5,   4,    0,   -4}, // 0x50 'P'
+    {  137,   4,   5,   5,    0,   -4}, // 0x51 'Q'
+    {  141,   3,   5,   4,    0,   -4}, // 0x52 'R'
+    {  144,   3,   5,   4,    0,   -4}, // 0x53 'S'
+    {  147,   3,   5,   4,    0,   -4}, // 0x54 'T'
+    {  150,   3,   5,   4,    0,   -4}, // 0x55 'U'
+    {  153,   3,   5,   4,    0,   -4}, // 0x56 'V'
+    {  156,   5,   5,   6,    0,   -4}, // 0x57 'W'
+    {  161,   3,   5,   4,    0,   -4}, // 0x58 'X'
+    {  164,   3,   5,   4,    0,   -4}, // 0x59 'Y'
+    {  167,   3,   5,   4,    0,   -4}, // 0x5A 'Z'
+    {  170,   3,   5,   4,    0,   -4}, // 0x5B '['
+    {  173,   3,   3,   4,    0,   -3}, // 0x5C ' '
+    {  176,   3,   5,   4,    0,   -4}, // 0x5D ']'
+    {  179,   3,   2,   4,    0,   -4}, // 0x5E '^'
+    {  182,   3,   1,   4,    0,    0}, // 0x5F '_'
+    {  185,   2,   2,   3,    0,   -4}, // 0x60 '`'
+    {  187,   3,   4,   4,    0,   -3}, // 0x61 'a'
+    {  190,   3,   5,   4,    0,   -4}, // 0x62 'b'
+    {  193,   3,   4,   4,    0,   -3}, // 0x63 'c'
+    {  196,   3,   5,   4,    0,   -4}, // 0x64 'd'
+    {  199,   3,   4,   4,    0,   -3}, // 0x65 'e'
+    {  202,   3,   5,   4,    0,   -4}, // 0x66 'f'
+    {  205,   3,   5,   4,    0,   -3}, // 0x67 'g'
+    {  208,   3,   5,   4,    0,   -4}, // 0x68 'h'
+    {  211,   1,   5,   2,    0,   -4}, // 0x69 'i'
+    {  212,   3,   6,   4,    0,   -4}, // 0x6A 'j'
+    {  215,   3,   5,   4,    0,   -4}, // 0x6B 'k'
+    {  218,   3,   5,   4,    0,   -4}, // 0x6C 'l'
+    {  221,   5,   4,   6,    0,   -3}, // 0x6D 'm'
+    {  226,   3,   4,   4,    0,   -3}, // 0x6E 'n'
+    {  229,   3,   4,   4,    0,   -3}, // 0x6F 'o'
+    {  232,   3,   5,   4,    0,   -3}, // 0x70 'p'
+    {  235,   3,   5,   4,    0,   -3}, // 0x71 'q'
+    {  238,   3,   4,   4,    0,   -3}, // 0x72 'r'
+    {  241,   3,   4,   4,    0,   -3}, // 0x73 's'
+    {  244,   3,   5,   4,    0,   -4}, // 0x74 't'
+    {  247,   3,   4,   4,    0,   -3}, // 0x75 'u'
+    {  250,   3,   4,   4,    0,   -3}, // 0x76 'v'
+    {  253,   5,   4,   6,    0,   -3}, // 0x77 'w'
+    {  258,   3,   4,   4,    0,   -3}, // 0x78 'x'
+    {  261,   3,   5,   4,    0,   -3}, // 0x79 'y'
+    {  264,   3,   4,   4,    0,   -3}, // 0x7A 'z'
+    {  267,   3,   5,   4,    0,   -4}, // 0x7B '{'
+    {  270,   1,   5,   2,    0,   -4}, // 0x7C '|'
+    {  271,   3,   5,   4,    0,   -4}, // 0x7D '}'
+    {  274,   3,   2,   4,    0,   -4}, // 0x7E '~'
+};
+
+const GFXfont TomThumb PROGMEM = {(uint8_t *)TomThumbPageBitmaps,
+    (GFXglyph *)TomThumbPageGlyphs, 0x20, 0x7E, 6};
@@ -0,0 +1,156 @@
+// Generated by toolchain/font_atlas.py from fonts/muHeavy8ptBold.h, do not edit.
+// Page layout: per glyph ceil(height / 8) strips of width column bytes, LSB on top.
+#include "../../gfxfont.h"
+
+const uint8_t muHeavy8ptBoldPageBitmaps[] PROGMEM = {
+    0x5F, 0x5F, 0x07, 0x07, 0x07, 0x00, 0x07, 0x07, 0x22, 0x7F, 0x7F, 0x22,
+    0x7F, 0x7F, 0x22, 0x24, 0x2E, 0x2A, 0x7F, 0x2A, 0x3A, 0x10, 0x46, 0x25,
+    0x13, 0x08, 0x64, 0x52, 0x31, 0x36, 0x7F, 0x49, 0x5F, 0x76, 0x60, 0x50,
+    0x07, 0x07, 0x1C, 0x3E, 0x63, 0x41, 0x41, 0x63, 0x3E, 0x1C, 0x04, 0x15,
+    0x1F, 0x0E, 0x1F, 0x15, 0x04, 0x04, 0x04, 0x1F, 0x1F, 0x04, 0x04, 0x04,
+    0x07, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x60, 0x70,
+    0x18, 0x0C, 0x07, 0x03, 0x3E, 0x7F, 0x41, 0x41, 0x41, 0x7F, 0x3E, 0x00,
+    0x42, 0x7F, 0x7F, 0x40, 0x00, 0x42, 0x63, 0x71, 0x59, 0x4D, 0x47, 0x42,
+    0x22, 0x63, 0x41, 0x49, 0x49, 0x7F, 0x36, 0x30, 0x38, 0x2C, 0x26, 0x7F,
+    0x7F, 0x20, 0x2F, 0x6F, 0x49, 0x49, 0x49, 0x79, 0x31, 0x3E, 0x7F, 0x49,
+    0x49, 0x49, 0x7B, 0x32, 0x03, 0x03, 0x41, 0x71, 0x3D, 0x0F, 0x03, 0x36,
+    0x7F, 0x49, 0x49, 0x49, 0x7F, 0x36, 0x26, 0x6F, 0x49, 0x49, 0x49, 0x7F,
+    0x3E, 0x1B, 0x1B, 0x20, 0x3B, 0x1B, 0x08, 0x1C, 0x36, 0x63, 0x41, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x41, 0x63, 0x36, 0x1C, 0x08, 0x06, 0x07,
+    0x53, 0x53, 0x53, 0x5B, 0x0F, 0x06, 0x3E, 0x41, 0x5D, 0x55, 0x5D, 0x51,
+    0x1E, 0x7C, 0x7E, 0x13, 0x11, 0x13, 0x7E, 0x7C, 0x7F, 0x7F, 0x49, 0x49,
+    0x49, 0x7F, 0x36, 0x1C, 0x3E, 0x63, 0x41, 0x41, 0x63, 0x22, 0x7F, 0x7F,
+    0x41, 0x41, 0x63, 0x3E, 0x1C, 0x7F, 0x7F, 0x49, 0x49, 0x49, 0x49, 0x41,
+    0x7F, 0x7F, 0x09, 0x09, 0x09, 0x09, 0x01, 0x1C, 0x3E, 0x63, 0x41, 0x49,
+    0x79, 0x79, 0x7F, 0x7F, 0x08, 0x08, 0x08, 0x7F, 0x7F, 0x41, 0x41, 0x7F,
+    0x7F, 0x41, 0x41, 0x20, 0x60, 0x40, 0x40, 0x40, 0x7F, 0x3F, 0x7F, 0x7F,
+    0x18, 0x3C, 0x76, 0x63, 0x41, 0x7F, 0x7F, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x7F, 0x7F, 0x0E, 0x1C, 0x0E, 0x7F, 0x7F, 0x7F, 0x7F, 0x0E, 0x1C, 0x38,
+    0x7F, 0x7F, 0x3E, 0x7F, 0x41, 0x41, 0x41, 0x7F, 0x3E, 0x7F, 0x7F, 0x11,
+    0x11, 0x11, 0x1F, 0x0E, 0x3E, 0x7F, 0x41, 0x51, 0x71, 0x3F, 0x5E, 0x7F,
+    0x7F, 0x11, 0x31, 0x79, 0x6F, 0x4E, 0x26, 0x6F, 0x49, 0x49, 0x4B, 0x7A,
+    0x30, 0x01, 0x01, 0x7F, 0x7F, 0x01, 0x01, 0x3F, 0x7F, 0x40, 0x40, 0x40,
+    0x7F, 0x3F, 0x0F, 0x1F, 0x38, 0x70, 0x38, 0x1F, 0x0F, 0x7F, 0x7F, 0x38,
+    0x1C, 0x38, 0x7F, 0x7F, 0x63, 0x77, 0x3E, 0x1C, 0x3E, 0x77, 0x63, 0x07,
+    0x0F, 0x78, 0x78, 0x0F, 0x07, 0x61, 0x71, 0x79, 0x5D, 0x4F, 0x47, 0x43,
+    0x7F, 0x7F, 0x41, 0x41, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x41,
+    0x41, 0x7F, 0x7F, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x08, 0x1D, 0x15, 0x15, 0x15, 0x1F, 0x1E,
+    0x3F, 0x7F, 0x44, 0x44, 0x44, 0x7C, 0x38, 0x0E, 0x1F, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x38, 0x7C, 0x44, 0x44, 0x44, 0x7F, 0x7F, 0x0E, 0x1F, 0x15,
+    0x15, 0x15, 0x17, 0x16, 0x04, 0x04, 0x3E, 0x3F, 0x05, 0x05, 0x06, 0x2F,
+    0x29, 0x29, 0x29, 0x3F, 0x1F, 0x7F, 0x7F, 0x04, 0x04, 0x04, 0x7C, 0x78,
+    0x40, 0x44, 0x7D, 0x7D, 0x40, 0x40, 0x80, 0x80, 0x80, 0x84, 0xFD, 0x7D,
+    0x7F, 0x7F, 0x18, 0x38, 0x7C, 0x6C, 0x44, 0x40, 0x41, 0x7F, 0x7F, 0x40,
+    0x40, 0x1F, 0x1F, 0x01, 0x1F, 0x1F, 0x01, 0x1F, 0x1E, 0x1F, 0x1F, 0x01,
+    0x01, 0x01, 0x1F, 0x1E, 0x0E, 0x1F, 0x11, 0x11, 0x11, 0x1F, 0x0E, 0x3F,
+    0x3F, 0x09, 0x09, 0x09, 0x0F, 0x06, 0x06, 0x0F, 0x09, 0x09, 0x09, 0x3F,
+    0x3F, 0x1F, 0x1F, 0x02, 0x01, 0x01, 0x01, 0x01, 0x12, 0x17, 0x15, 0x15,
+    0x15, 0x1D, 0x08, 0x04, 0x04, 0x7F, 0x7F, 0x04, 0x04, 0x0F, 0x1F, 0x10,
+    0x10, 0x10, 0x1F, 0x1F, 0x07, 0x0F, 0x18, 0x18, 0x0F, 0x07, 0x0F, 0x1F,
+    0x10, 0x1F, 0x1F, 0x10, 0x1F, 0x1F, 0x1B, 0x1B, 0x0E, 0x0E, 0x0A, 0x1B,
+    0x1B, 0x07, 0x2F, 0x28, 0x28, 0x28, 0x3F, 0x1F, 0x11, 0x19, 0x1D, 0x1F,
+    0x17, 0x13, 0x11, 0x08, 0x3E, 0x77, 0x41, 0x7F, 0x7F, 0x41, 0x77, 0x3E,
+    0x08, 0x02, 0x01, 0x03, 0x07, 0x06, 0x04, 0x02,
+};
+
+const GFXglyph muHeavy8ptBoldPageGlyphs[] PROGMEM = {
+    {    0,   0,   0,   2,    0,    0}, // 0x20 ' '
+    {    0,   3,   7,   4,    0,   -6}, // 0x21 '!'
+    {    3,   5,   3,   6,    0,   -6}, // 0x22 '"'
+    {    8,   7,   7,   8,    0,   -6}, // 0x23 '#'
+    {   15,   7,   7,   8,    0,   -6}, // 0x24 '$'
+    {   22,   7,   7,   8,    0,   -6}, // 0x25 '%'
+    {   29,   7,   7,   8,    0,   -6}, // 0x26 '&'
+    {   36,   2,   3,   3,    0,   -6}, // 0x27 '''
+    {   38,   4,   7,   5,    0,   -6}, // 0x28 '('
+    {   42,   4,   7,   5,    0,   -6}, // 0x29 ')'
+    {   46,   7,   5,   8,    0,   -5}, // 0x2A '*'
+    {   53,   6,   5,   7,    0,   -5}, // 0x2B '+'
+    {   59,   3,   3,   4,    0,   -1}, // 0x2C ','
+    {   62,   6,   1,   7,    0,   -3}, // 0x2D '-'
+    {   68,   2,   2,   3,    0,   -1}, // 0x2E '.'
+    {   70,   6,   7,   7,    0,   -6}, // 0x2F '/'
+    {   76,   7,   7,   8,    0,   -6}, // 0x30 '0'
+    {   83,   6,   7,   7,    0,   -6}, // 0x31 '1'
+    {   89,   7,   7,   8,    0,   -6}, // 0x32 '2'
+    {   96,   7,   7,   8,    0,   -6}, // 0x33 '3'
+    {  103,   7,   7,   8,    0,   -6}, // 0x34 '4'
+    {  110,   7,   7,   8,    0,   -6}, // 0x35 '5'
+    {  117,   7,   7,   8,    0,   -6}, // 0x36 '6'
+    {  124,   7,   7,   8,    0,   -6}, // 0x37 '7'
+    {  131,   7,   7,   8,    0,   -6}, // 0x38 '8'
+    {  138,   7,   7,   8,    0,   -6}, // 0x39 '9'
+    {  145,   2,   5,   3,    0,   -5}, // 0x3A ':'
+    {  147,   3,   6,   4,    0,   -4}, // 0x3B ';'
+    {  150,   5,   7,   6,    0,   -6}, // 0x3C '<'
+    {  155,   6,   3,   7,    0,   -4}, // 0x3D '='
+    {  161,   5,   7,   6,    0,   -6}, // 0x3E '>'
+    {  166,   8,   7,   8,    0,   -6}, // 0x3F '?'
+    {  174,   7,   7,   8,    0,   -6}, // 0x40 '@'
+    {  181,   7,   7,   8,    0,   -6}, // 0x41 'A'
+    {  188,   7,   7,   8,    0,   -6}, // 0x42 'B'
+    {  195,   7,   7,   8,    0,   -6}, // 0x43 'C'
+    {  202,   7,   7,   8,    0,   -6}, // 0x44 'D'
+    {  209,   7,   7,   8,    0,   -6}, // 0x45 'E'
+    {  216,   7,   7,   8,    0,   -6}, // 0x46 'F'
+    {  223,   7,   7,   8,    0,   -6}, // 0x47 'G'
+    {  230,   7,   7,   8,    0,   -6}, // 0x48 'H'
+    {  237,   6,   7,   7,    0,   -6}, // 0x49 'I'
+    {  243,   7,   7,   8,    0,   -6}, // 0x4A 'J'
+    {  250,   7,   7,   8,    0,   -6}, // 0x4B 'K'
+    {  257,   7,   7,   8,    0,   -6}, // 0x4C 'L'
+    {  264,   7,   7,   8,    0,   -6}, // 0x4D 'M'
+    {  271,   7,   7,   8,    0,   -6}, // 0x4E 'N'
+    {  278,   7,   7,   8,    0,   -6}, // 0x4F 'O'
+    {  285,   7,   7,   8,    0,   -6}, // 0x50 'P'
+    {  292,   7,   7,   8,    0,   -6}, // 0x51 'Q'
+    {  299,   7,   7,   8,    0,   -6}, // 0x52 'R'
+    {  306,   7,   7,   8,    0,   -6}, // 0x53 'S'
+    {  313,   6,   7,   7,    0,   -6}, // 0x54 'T'
+    {  319,   7,   7,   8,    0,   -6}, // 0x55 'U'
+    {  326,   7,   7,   8,    0,   -6}, // 0x56 'V'
+    {  333,   7,   7,   8,    0,   -6}, // 0x57 'W'
+    {  340,   7,   7,   8,    0,   -6}, // 0x58 'X'
+    {  347,   6,   7,   7,    0,   -6}, // 0x59 'Y'
+    {  353,   7,   7,   8,    0,   -6}, // 0x5A 'Z'
+    {  360,   4,   7,   5,    0,   -6}, // 0x5B '['
+    {  364,   7,   7,   8,    0,   -6}, // 0x5C ' '
+    {  371,   4,   7,   5,    0,   -6}, // 0x5D ']'
+    {  375,   5,   2,   6,    0,   -6}, // 0x5E '^'
+    {  380,   7,   1,   8,    0,   -1}, // 0x5F '_'
+    {  387,   2,   2,   3,    0,   -6}, // 0x60 '`'
+    {  389,   7,   5,   8,    0,   -4}, // 0x61 'a'
+    {  396,   7,   7,   8,    0,   -6}, // 0x62 'b'
+    {  403,   7,   5,   8,    0,   -4}, // 0x63 'c'
+    {  410,   7,   7,   8,    0,   -6}, // 0x64 'd'
+    {  417,   7,   5,   8,    0,   -4}, // 0x65 'e'
+    {  424,   6,   6,   7,    0,   -5}, // 0x66 'f'
+    {  430,   7,   6,   8,    0,   -4}, // 0x67 'g'
+    {  437,   7,   7,   8,    0,   -6}, // 0x68 'h'
+    {  444,   6,   7,   7,    0,   -6}, // 0x69 'i'
+    {  450,   6,   8,   7,    0,   -6}, // 0x6A 'j'
+    {  456,   7,   7,   8,    0,   -6}, // 0x6B 'k'
+    {  463,   6,   7,   7,    0,   -6}, // 0x6C 'l'
+    {  469,   8,   5,   9,    0,   -4}, // 0x6D 'm'
+    {  477,   7,   5,   8,    0,   -4}, // 0x6E 'n'
+    {  484,   7,   5,   8,    0,   -4}, // 0x6F 'o'
+    {  491,   7,   6,   8,    0,   -4}, // 0x70 'p'
+    {  498,   7,   6,   8,    0,   -4}, // 0x71 'q'
+    {  505,   7,   5,   8,    0,   -4}, // 0x72 'r'
+    {  512,   7,   5,   8,    0,   -4}, // 0x73 's'
+    {  519,   6,   7,   7,    0,   -6}, // 0x74 't'
+    {  525,   7,   5,   8,    0,   -4}, // 0x75 'u'
+    {  532,   6,   5,   7,    0,   -4}, // 0x76 'v'
+    {  538,   8,   5,   9,    0,   -4}, // 0x77 'w'
+    {  546,   7,   5,   8,    0,   -4}, // 0x78 'x'
+    {  553,   7,   6,   8,    0,   -4}, // 0x79 'y'
+    {  560,   7,   5,   8,    0,   -4}, // 0x7A 'z'
+    {  567,   4,   7,   5,    0,   -6}, // 0x7B '{'
+    {  571,   2,   7,   3,    0,   -6}, // 0x7C '|'
+    {  573,   4,   7,   5,    0,   -6}, // 0x7D '}'
+    {  577,   7,   3,   8,    0,   -5}, // 0x7E '~'
+};
+
+const GFXfont muHeavy8ptBold PROGMEM = {(uint8_t *)muHeavy8ptBoldPageBitmaps,
+    (GFXglyph *)muHeavy8ptBoldPageGlyphs, 0x20, 0x7E, 8};
@@ -0,0 +1,141 @@
+// Generated by toolchain/font_atlas.py from fonts/muMatrix8ptRegular.h, do not edit.
+// Page layout: per glyph ceil(height / 8) strips of width column bytes, LSB on top.
+#include "../../gfxfont.h"
+
+const uint8_t MuMatrix8ptRegularPageBitmaps[] PROGMEM = {
+    0x5F, 0x03, 0x00, 0x03, 0x14, 0x7F, 0x14, 0x7F, 0x14, 0x26, 0x49, 0x7F,
+    0x49, 0x32, 0x43, 0x33, 0x08, 0x66, 0x61, 0x32, 0x4D, 0x49, 0x51, 0x22,
+    0x50, 0x03, 0x1C, 0x22, 0x41, 0x41, 0x22, 0x1C, 0x22, 0x14, 0x0F, 0x14,
+    0x22, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x04, 0x03, 0x01, 0x01, 0x01, 0x01,
+    0x60, 0x1C, 0x03, 0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00, 0x42, 0x7F, 0x40,
+    0x00, 0x42, 0x61, 0x51, 0x49, 0x46, 0x22, 0x49, 0x49, 0x49, 0x36, 0x30,
+    0x2C, 0x22, 0x7F, 0x20, 0x2F, 0x49, 0x49, 0x49, 0x31, 0x3E, 0x49, 0x49,
+    0x49, 0x32, 0x03, 0x41, 0x31, 0x0D, 0x03, 0x36, 0x49, 0x49, 0x49, 0x36,
+    0x26, 0x49, 0x49, 0x49, 0x3E, 0x09, 0x20, 0x19, 0x08, 0x14, 0x22, 0x41,
+    0x05, 0x05, 0x05, 0x05, 0x41, 0x22, 0x14, 0x08, 0x02, 0x51, 0x09, 0x06,
+    0x3E, 0x41, 0x5D, 0x55, 0x5D, 0x51, 0x1E, 0x7E, 0x09, 0x09, 0x09, 0x7E,
+    0x7F, 0x49, 0x49, 0x49, 0x36, 0x3E, 0x41, 0x41, 0x41, 0x22, 0x7F, 0x41,
+    0x41, 0x41, 0x3E, 0x7F, 0x49, 0x49, 0x41, 0x7F, 0x09, 0x09, 0x01, 0x3E,
+    0x41, 0x49, 0x49, 0x3A, 0x7F, 0x08, 0x08, 0x08, 0x7F, 0x41, 0x7F, 0x41,
+    0x20, 0x40, 0x41, 0x3F, 0x01, 0x7F, 0x08, 0x14, 0x22, 0x41, 0x7F, 0x40,
+    0x40, 0x40, 0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x7F, 0x04, 0x08, 0x10, 0x7F,
+    0x3E, 0x41, 0x41, 0x41, 0x3E, 0x7F, 0x09, 0x09, 0x09, 0x06, 0x3E, 0x41,
+    0x51, 0x21, 0x5E, 0x7F, 0x09, 0x19, 0x29, 0x46, 0x46, 0x49, 0x49, 0x49,
+    0x31, 0x01, 0x01, 0x7F, 0x01, 0x01, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x0F,
+    0x30, 0x40, 0x30, 0x0F, 0x3F, 0x40, 0x38, 0x40, 0x3F, 0x63, 0x14, 0x08,
+    0x14, 0x63, 0x07, 0x08, 0x70, 0x08, 0x07, 0x61, 0x51, 0x49, 0x45, 0x43,
+    0x7F, 0x41, 0x03, 0x1C, 0x60, 0x41, 0x7F, 0x04, 0x02, 0x01, 0x02, 0x04,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x08, 0x15, 0x15, 0x15, 0x1E,
+    0x7F, 0x48, 0x44, 0x44, 0x38, 0x0E, 0x11, 0x11, 0x11, 0x00, 0x38, 0x44,
+    0x44, 0x48, 0x3F, 0x0E, 0x15, 0x15, 0x15, 0x06, 0x08, 0xFE, 0x09, 0x01,
+    0x06, 0x29, 0x29, 0x29, 0x1F, 0x7F, 0x08, 0x04, 0x04, 0x78, 0x44, 0x7D,
+    0x40, 0x20, 0x40, 0x40, 0x3D, 0x7F, 0x10, 0x28, 0x44, 0x41, 0x7F, 0x40,
+    0x1F, 0x01, 0x06, 0x01, 0x1E, 0x1F, 0x02, 0x01, 0x01, 0x1E, 0x0E, 0x11,
+    0x11, 0x11, 0x0E, 0x3E, 0x05, 0x09, 0x09, 0x06, 0x06, 0x09, 0x09, 0x09,
+    0x3E, 0x1F, 0x02, 0x01, 0x01, 0x02, 0x12, 0x15, 0x15, 0x15, 0x08, 0x04,
+    0x3F, 0x44, 0x40, 0x20, 0x0F, 0x10, 0x10, 0x10, 0x0F, 0x07, 0x08, 0x10,
+    0x08, 0x07, 0x0F, 0x10, 0x0C, 0x10, 0x0F, 0x11, 0x0A, 0x04, 0x0A, 0x11,
+    0x07, 0x28, 0x28, 0x28, 0x1F, 0x11, 0x19, 0x15, 0x13, 0x11, 0x08, 0x36,
+    0x41, 0x7F, 0x41, 0x36, 0x08, 0x02, 0x01, 0x02, 0x04, 0x02,
+};
+
+const GFXglyph MuMatrix8ptRegularPageGlyphs[] PROGMEM = {
+    {    0,   0,   0,   2,    0,    0}, // 0x20 ' '
+    {    0,   1,   7,   2,    0,   -6}, // 0x21 '!'
+    {    1,   3,   2,   4,    0,   -6}, // 0x22 '"'
+    {    4,   5,   7,   6,    0,   -6}, // 0x23 '#'
+    {    9,   5,   7,   6,    0,   -6}, // 0x24 '$'
+    {   14,   5,   7,   6,    0,   -6}, // 0x25 '%'
+    {   19,   6,   7,   7,    0,   -6}, // 0x26 '&'
+    {   25,   1,   2,   2,    0,   -6}, // 0x27 '''
+    {   26,   3,   7,   4,    0,   -6}, // 0x28 '('
+    {   29,   3,   7,   4,    0,   -6}, // 0x29 ')'
+    {   32,   5,   6,   6,    0,   -5}, // 0x2A '*'
+    {   37,   5,   5,   6,    0,   -5}, // 0x2B '+'
+    {   42,   2,   3,   3,    0,   -1}, // 0x2C ','
+    {   44,   3,   1,   5,    1,   -3}, // 0x2D '-'
+    {   47,   1,   1,   2,    0,    0}, // 0x2E '.'
+    {   48,   3,   7,   4,    0,   -6}, // 0x2F '/'
+    {   51,   5,   7,   6,    0,   -6}, // 0x30 '0'
+    {   56,   5,   7,   6,    0,   -6}, // 0x31 '1'
+    {   61,   5,   7,   6,    0,   -6}, // 0x32 '2'
+    {   66,   5,   7,   6,    0,   -6}, // 0x33 '3'
+    {   71,   5,   7,   6,    0,   -6}, // 0x34 '4'
+    {   76,   5,   7,   6,    0,   -6}, // 0x35 '5'
+    {   81,   5,   7,   6,    0,   -6}, // 0x36 '6'
+    {   86,   5,   7,   6,    0,   -6}, // 0x37 '7'
+    {   91,   5,   7,   6,    0,   -6}, // 0x38 '8'
+    {   96,   5,   7,   6,    0,   -6}, // 0x39 '9'
+    {  101,   1,   4,   2,    0,   -4}, // 0x3A ':'
+    {  102,   2,   6,   2,   -1,   -4}, // 0x3B ';'
+    {  104,   4,   7,   5,    0,   -6}, // 0x3C '<'
+    {  108,   4,   3,   5,    0,   -4}, // 0x3D '='
+    {  112,   4,   7,   5,    0,   -6}, // 0x3E '>'
+    {  116,   4,   7,   5,    0,   -6}, // 0x3F '?'
+    {  120,   7,   7,   8,    0,   -6}, // 0x40 '@'
+    {  127,   5,   7,   6,    0,   -6}, // 0x41 'A'
+    {  132,   5,   7,   6,    0,   -6}, // 0x42 'B'
+    {  137,   5,   7,   6,    0,   -6}, // 0x43 'C'
+    {  142,   5,   7,   6,    0,   -6}, // 0x44 'D'
+    {  147,   4,   7,   5,    0,   -6}, // 0x45 'E'
+    {  151,   4,   7,   5,    0,   -6}, // 0x46 'F'
+    {  155,   5,   7,   6,    0,   -6}, // 0x47 'G'
+    {  160,   5,   7,   6,    0,   -6}, // 0x48 'H'
+    {  165,   3,   7,   4,    0,   -6}, // 0x49 'I'
+    {  168,   5,   7,   6,    0,   -6}, // 0x4A 'J'
+    {  173,   5,   7,   6,    0,   -6}, // 0x4B 'K'
+    {  178,   4,   7,   5,    0,   -6}, // 0x4C 'L'
+    {  182,   5,   7,   6,    0,   -6}, // 0x4D 'M'
+    {  187,   5,   7,   6,    0,   -6}, // 0x4E 'N'
+    {  192,   5,   7,   6,    0,   -6}, // 0x4F 'O'
+    {  197,   5,   7,   6,    0,   -6}, // 0x50 'P'
+    {  202,   5,   7,   6,    0,   -6}, // 0x51 'Q'
+    {  207,   5,   7,   6,    0,   -6}, // 0x52 'R'
+    {  212,   5,   7,   6,    0,   -6}, // 0x53 'S'
+    {  217,   5,   7,   6,    0,   -6}, // 0x54 'T'
+    {  222,   5,   7,   6,    0,   -6}, // 0x55 'U'
+    {  227,   5,   7,   6,    0,   -6}, // 0x56 'V'
+    {  232,   5,   7,   6,    0,   -6}, // 0x57 'W'
+    {  237,   5,   7,   6,    0,   -6}, // 0x58 'X'
+    {  242,   5,   7,   6,    0,   -6}, // 0x59 'Y'
+    {  247,   5,   7,   6,    0,   -6}, // 0x5A 'Z'
+    {  252,   2,   7,   3,    0,   -6}, // 0x5B '['
+    {  254,   3,   7,   4,    0,   -6}, // 0x5C ' '
+    {  257,   2,   7,   3,    0,   -6}, // 0x5D ']'
+    {  259,   5,   3,   6,    0,   -6}, // 0x5E '^'
+    {  264,   5,   1,   6,    0,   -1}, // 0x5F '_'
+    {  269,   2,   2,   2,   -1,   -6}, // 0x60 '`'
+    {  271,   5,   5,   6,    0,   -4}, // 0x61 'a'
+    {  276,   5,   7,   6,    0,   -6}, // 0x62 'b'
+    {  281,   5,   5,   6,    0,   -4}, // 0x63 'c'
+    {  286,   5,   7,   6,    0,   -6}, // 0x64 'd'
+    {  291,   5,   5,   6,    0,   -4}, // 0x65 'e'
+    {  296,   4,   8,   4,    0,   -6}, // 0x66 'f'
+    {  300,   5,   6,   6,    0,   -4}, // 0x67 'g'
+    {  305,   5,   7,   6,    0,   -6}, // 0x68 'h'
+    {  310,   3,   7,   4,    0,   -6}, // 0x69 'i'
+    {  313,   4,   7,   5,    0,   -6}, // 0x6A 'j'
+    {  317,   4,   7,   5,    0,   -6}, // 0x6B 'k'
+    {  321,   3,   7,   4,    0,   -6}, // 0x6C 'l'
+    {  324,   5,   5,   6,    0,   -4}, // 0x6D 'm'
+    {  329,   5,   5,   6,    0,   -4}, // 0x6E 'n'
+    {  334,   5,   5,   6,    0,   -4}, // 0x6F 'o'
+    {  339,   5,   6,   6,    0,   -4}, // 0x70 'p'
+    {  344,   5,   6,   6,    0,   -4}, // 0x71 'q'
+    {  349,   5,   5,   6,    0,   -4}, // 0x72 'r'
+    {  354,   5,   5,   6,    0,   -4}, // 0x73 's'
+    {  359,   5,   7,   6,    0,   -6}, // 0x74 't'
+    {  364,   5,   5,   6,    0,   -4}, // 0x75 'u'
+    {  369,   5,   5,   6,    0,   -4}, // 0x76 'v'
+    {  374,   5,   5,   6,    0,   -4}, // 0x77 'w'
+    {  379,   5,   5,   6,    0,   -4}, // 0x78 'x'
+    {  384,   5,   6,   6,    0,   -4}, // 0x79 'y'
+    {  389,   5,   5,   6,    0,   -4}, // 0x7A 'z'
+    {  394,   3,   7,   4,    0,   -6}, // 0x7B '{'
+    {  397,   1,   7,   2,    0,   -6}, // 0x7C '|'
+    {  398,   3,   7,   4,    0,   -6}, // 0x7D '}'
+    {  401,   5,   3,   6,    0,   -4}, // 0x7E '~'
+};
+
+const GFXfont MuMatrix8ptRegular PROGMEM = {(uint8_t *)MuMatrix8ptRegularPageBitmaps,
+    (GFXglyph *)MuMatrix8ptRegularPageGlyphs, 0x20, 0x7E, 8};
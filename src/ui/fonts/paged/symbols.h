@@ -0,0 +1,41 @@
+// Generated by toolchain/font_atlas.py from fonts/symbols.h, do not edit.
+// Page layout: per glyph ceil(height / 8) strips of width column bytes, LSB on top.
+#include "../../gfxfont.h"
+
+const uint8_t SymbolsPageBitmaps[] PROGMEM = {
+    0x1C, 0x1F, 0x1C, 0x1E, 0x1C, 0x0F, 0x02, 0x04, 0x02, 0x0F, 0xF0, 0x50,
+    0xA0, 0x92, 0x92, 0x92, 0x92, 0x00, 0x49, 0x92, 0x49, 0x03, 0x04, 0x03,
+    0x38, 0x14, 0x60, 0x90, 0x60, 0x00, 0x18, 0x1F, 0x02, 0xC0, 0xF8, 0x10,
+    0x00, 0xFF, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0xFE, 0x1F, 0x0E, 0x1F,
+    0x0E, 0x1F, 0x0E, 0x1F, 0x00, 0x0E, 0x0E, 0x1F, 0x1F, 0x1F, 0x02, 0x04,
+    0x02, 0x1F, 0x15, 0x05, 0x19, 0x02, 0x1C, 0x0E, 0x13, 0x15, 0x11, 0x0E,
+    0x0E, 0x0E, 0x1F, 0x00, 0x0A, 0x04, 0x0A, 0x1E, 0x1D, 0x1D, 0x1D, 0x1E,
+    0x0C, 0x10, 0x15, 0x01, 0x06, 0x04, 0x00, 0x0A, 0x04, 0x11, 0x0E, 0x00,
+    0x1F, 0x11, 0x11, 0x0E, 0x00, 0x00, 0x17, 0x00, 0x00,
+};
+
+const GFXglyph SymbolsPageGlyphs[] PROGMEM = {
+    {    0,   5,   5,   6,    0,   -4}, // 0x30 '0'
+    {    5,   8,   8,   8,    0,   -7}, // 0x31 '1'
+    {   13,   8,   8,   8,    0,   -7}, // 0x32 '2'
+    {   21,   8,   8,   8,    0,   -7}, // 0x33 '3'
+    {   29,   0,   0,   0,    0,    0}, // 0x34 '4'
+    {   29,   0,   0,   0,    0,    0}, // 0x35 '5'
+    {   29,   8,   8,   8,    0,   -7}, // 0x36 '6'
+    {   37,   8,   8,   8,    0,   -7}, // 0x37 '7'
+    {   45,   0,   0,   0,    0,    0}, // 0x38 '8'
+    {   45,   7,   5,   8,    0,   -4}, // 0x39 '9'
+    {   52,   5,   5,   6,    0,   -4}, // 0x3A ':'
+    {   57,   5,   5,   6,    0,   -4}, // 0x3B ';'
+    {   62,   5,   5,   6,    0,   -4}, // 0x3C '<'
+    {   67,   5,   5,   6,    0,   -4}, // 0x3D '='
+    {   72,   7,   5,   8,    0,   -4}, // 0x3E '>'
+    {   79,   5,   5,   6,    0,   -4}, // 0x3F '?'
+    {   84,   5,   5,   6,    0,   -4}, // 0x40 '@'
+    {   89,   6,   5,   7,    0,   -4}, // 0x41 'A'
+    {   95,   5,   5,   6,    0,   -4}, // 0x42 'B'
+    {  100,   5,   5,   6,    0,   -4}, // 0x43 'C'
+};
+
+const GFXfont Symbols PROGMEM = {(uint8_t *)SymbolsPageBitmaps,
+    (GFXglyph *)SymbolsPageGlyphs, 0x30, 0x43, 5};
@@ -18,6 +18,7 @@
 
 #include "drivers/bsp/st7565.h"
 #include "ui/font.h"
+#include "ui/ag_menu.h"
 #include "ui/helper.h"
 #include "ui/inputbox.h"
 #include "core/misc.h"
@@ -373,6 +374,7 @@ void UI_DisplayPopup(const char *string)
 void UI_DisplayClear()
 {
     memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
+    AG_MENU_Invalidate();
 }
 
 void PutPixelStatus(uint8_t x, uint8_t y, bool fill) {
@@ -488,6 +490,19 @@ void UI_FormatTemp(char *str, int16_t deciCelsius)
     str[5] = 'C';
     str[6] = '\0';
 }
+
+#ifdef ENABLE_BATTERY_MODEL
+void UI_FormatRuntime(char *str, uint16_t minutes)
+{
+    const uint8_t hours = minutes / 60;
+    const uint8_t digits = (hours >= 10) ? 2 : 1;
+
+    NUMBER_ToDecimal(str, hours, digits, false);
+    str[digits] = ':';
+    NUMBER_ToDecimal(str + digits + 1, minutes % 60, 2, true);
+    str[digits + 3] = '\0';
+}
+#endif
 void UI_DrawAntenna(uint8_t *buffer, uint8_t level) {
     // 1. Draw Antenna Body (Y-shape)
     // Diagram: X_X (Bit 1), _X_ (Bits 2-5)
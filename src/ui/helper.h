@@ -57,5 +57,8 @@ void UI_PrintFrequency(char *str, uint32_t frequency);
 void UI_PrintFrequencyEx(char *str, uint32_t frequency, bool highRes);
 void UI_FormatVoltage(char *str, uint16_t millivolts);
 void UI_FormatTemp(char *str, int16_t deciCelsius);
+#ifdef ENABLE_BATTERY_MODEL
+void UI_FormatRuntime(char *str, uint16_t minutes);
+#endif
 
 #endif
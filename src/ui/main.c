@@ -1044,7 +1044,7 @@ void UI_DisplayMain(void)
                 strcpy(String, "Charge  .  V    %");
                 NUMBER_ToDecimal(String + 7, gBatteryVoltageAverage / 100, 2, false);
                 NUMBER_ToDecimal(String + 10, gBatteryVoltageAverage % 100, 2, true);
-                NUMBER_ToDecimal(String + 13, BATTERY_VoltsToPercent(gBatteryVoltageAverage), 3, false);
+                NUMBER_ToDecimal(String + 13, BATTERY_GetPercent(), 3, false);
                 
                 UI_PrintStringSmallNormal(String, 2, 0, 3);
             }
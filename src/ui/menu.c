@@ -184,6 +184,7 @@ const t_menu_item MenuList[] =
     {"SetTmr",      MENU_SET_TMR       },
 #ifdef ENABLE_DEEP_SLEEP_MODE
     {"SetOff",       MENU_SET_OFF      },
+    {"SetDty",       MENU_SET_DTY      },
 #endif
 #ifdef ENABLE_NARROWER_BW_FILTER
     {"SetNFM",      MENU_SET_NFM       },
@@ -396,8 +397,13 @@ const char gSubMenu_BAT_TXT[][8] =
     "ICON",
     "I+VOLT",
     "I+PERC",
+#ifdef ENABLE_BATTERY_MODEL
+    "TIME",
+    "I+TIME"
+#else
     "VOLT",
     "PERC"
+#endif
 };
 
 const char gSubMenu_BATTYP[][12] =
@@ -453,6 +459,18 @@ const char gSubMenu_SCRAMBLER[][7] =
         "ALL"
     };
 
+#ifdef ENABLE_DEEP_SLEEP_MODE
+    // deep sleep RX window : sleep, see FUNCTION_GetSleep_10ms()
+    const char gSubMenu_SET_DTY[][7] =
+    {
+        "BATSAV",
+        "1:20",
+        "1:50",
+        "1:100",
+        "1:200"
+    };
+#endif
+
     const char gSubMenu_SET_LCK[][9] =
     {
         "KEYS",
@@ -576,14 +594,14 @@ void UI_DisplayMenu(void)
     char               Contact[16];
 #endif
 
-    UI_DisplayClear();
-
     if (AG_MENU_IsActive()) {
         AG_MENU_Render();
-        ST7565_BlitFullScreen();
+        AG_MENU_Blit();
         return;
     }
 
+    UI_DisplayClear();
+
 #ifdef ENABLE_CUSTOM_FIRMWARE_MODS
     UI_DrawLineBuffer(gFrameBuffer, 48, 0, 48, 55, 1); // Be ware, status zone = 8 lines, the rest = 56 ->total 64
     //UI_DrawLineDottedBuffer(gFrameBuffer, 0, 46, 50, 46, 1);
@@ -1282,6 +1300,10 @@ void UI_DisplayMenu(void)
                 //#endif
             }
             break;
+
+        case MENU_SET_DTY:
+            strcpy(String, gSubMenu_SET_DTY[gSubMenuSelection]);
+            break;
 #endif
 
 #ifdef ENABLE_CUSTOM_FIRMWARE_MODS
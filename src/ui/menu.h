@@ -134,6 +134,7 @@ enum
 #endif
 #ifdef ENABLE_DEEP_SLEEP_MODE
     MENU_SET_OFF,
+    MENU_SET_DTY,
 #endif
 #ifdef ENABLE_CUSTOM_FIRMWARE_MODS
     MENU_SET_PWR,
@@ -201,6 +202,10 @@ extern const char* const gSubMenu_MDF[4];
 extern const char        gSubMenu_D_RSP[4][11];
 #endif
 
+#ifdef ENABLE_DEEP_SLEEP_MODE
+    extern const char    gSubMenu_SET_DTY[5][7];
+#endif
+
 #ifdef ENABLE_CUSTOM_FIRMWARE_MODS
     extern const char    gSubMenu_SET_PWR[7][6];
     extern const char    gSubMenu_SET_PTT[3][7];
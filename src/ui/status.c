@@ -113,12 +113,28 @@ void UI_DisplayStatus() {
     }
 
     // 2. Battery Calculation (Pre-calculate to know available width for path/title)
+#ifdef ENABLE_BATTERY_MODEL
+    // VOLT / PERC duplicate VOLTAGE / PERCENT, the model reuses them for TIME / I+TIME
+    bool show_icon = (gSetting_battery_text >= 3 && gSetting_battery_text <= 5) || gSetting_battery_text == 7;
+    bool show_volt = (gSetting_battery_text == 1 || gSetting_battery_text == 4);
+    bool show_perc = (gSetting_battery_text == 2 || gSetting_battery_text == 5);
+    bool show_time = (gSetting_battery_text >= 6);
+#else
     bool show_icon = (gSetting_battery_text >= 3 && gSetting_battery_text <= 5);
     bool show_volt = (gSetting_battery_text == 1 || gSetting_battery_text == 4 || gSetting_battery_text == 6);
     bool show_perc = (gSetting_battery_text == 2 || gSetting_battery_text == 5 || gSetting_battery_text == 7);
+#endif
     
     char bat_str[10] = {0};
     uint8_t bat_str_width = 0;
+#ifdef ENABLE_BATTERY_MODEL
+    if (show_time && !gIsCharging) {
+        UI_FormatRuntime(bat_str, BATTERY_GetRuntimeMinutes());
+        bat_str_width = strlen(bat_str) * 4;
+    } else if (show_time) {
+        show_perc = true;
+    }
+#endif
     if (show_volt || show_perc) {
         if (show_volt) {
             const uint16_t voltage = (gBatteryVoltageAverage <= 999) ? gBatteryVoltageAverage : 999;
@@ -127,7 +143,7 @@ void UI_DisplayStatus() {
             NUMBER_ToDecimal(bat_str + 2, voltage % 100, 2, true);
             strcat(bat_str, "V");
         } else {
-            NUMBER_ToDecimal(bat_str, BATTERY_VoltsToPercent(gBatteryVoltageAverage), 3, false);
+            NUMBER_ToDecimal(bat_str, BATTERY_GetPercent(), 3, false);
             strcat(bat_str, "%");
         }
         bat_str_width = strlen(bat_str) * 4;
@@ -44,6 +44,7 @@
 #ifdef ENABLE_EEPROM_HEXDUMP
     #include "hexdump.h"
 #endif
+#include "ui/ag_menu.h"
 #include "ui/ui.h"
 #include "core/misc.h"
 
@@ -110,6 +111,8 @@ void GUI_SelectNextDisplay(GUI_DisplayType_t Display)
         gWasFKeyPressed      = false;
 
         gUpdateStatus        = true;
+
+        AG_MENU_Invalidate();
     }
 
     gScreenToDisplay = Display;
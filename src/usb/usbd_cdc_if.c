@@ -288,6 +288,11 @@ void cdc_acm_data_send_with_dtr(const uint8_t *buf, uint32_t size)
     }
 }
 
+bool cdc_acm_tx_busy(void)
+{
+    return ep_tx_busy_flag;
+}
+
 void cdc_acm_data_send_with_dtr_async(const uint8_t *buf, uint32_t size)
 {
     if (dtr_enable && 0 != size)
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+"""
+Font Atlas Converter
+Re-packs Adafruit GFXfont headers (row-major, bit-packed glyphs) into the
+ST7565 page layout used by AG_DrawBitmap: per glyph ceil(height / 8) strips
+of `width` column bytes, LSB on top. Glyph metrics are kept, only
+bitmapOffset moves, so the GFXfont struct and symbol names stay the same.
+
+Usage: font_atlas.py [-o src/ui/fonts/paged] src/ui/fonts/*.h
+"""
+
+import argparse
+import os
+import re
+import sys
+
+RESET = "\033[0m"
+BOLD = "\033[1m"
+INVERT = "\033[7m"
+RED = "\033[31m"
+GREEN = "\033[32m"
+BLUE = "\033[34m"
+
+def log_info(msg):    print(f"{BLUE}{INVERT} INFO {RESET} {msg}")
+def log_ok(msg):      print(f"{GREEN}{INVERT}  OK  {RESET} {msg}")
+def log_err(msg):     print(f"{RED}{INVERT} FAIL {RESET} {msg}"); sys.exit(1)
+
+def strip_comments(src):
+    src = re.sub(r'/\*.*?\*/', '', src, flags=re.S)
+    return re.sub(r'//[^\n]*', '', src)
+
+def parse_font(path):
+    src = strip_comments(open(path).read())
+
+    m = re.search(r'const\s+uint8_t\s+(\w+)\s*\[\]\s*PROGMEM\s*=\s*\{(.*?)\};', src, re.S)
+    if not m:
+        log_err(f"{path}: no bitmap array")
+    bitmap = [int(v, 0) for v in re.findall(r'0x[0-9A-Fa-f]+|\d+', m.group(2))]
+
+    m = re.search(r'const\s+GFXglyph\s+(\w+)\s*\[\]\s*PROGMEM\s*=\s*\{(.*)\};', src, re.S)
+    if not m:
+        log_err(f"{path}: no glyph array")
+    glyphs = [tuple(int(v) for v in g.split(','))
+              for g in re.findall(r'\{\s*(-?\d+\s*(?:,\s*-?\d+\s*){5})\}', m.group(2))]
+
+    m = re.search(r'const\s+GFXfont\s+(\w+)\s*PROGMEM\s*=\s*\{[^,]*,[^,]*,\s*(\w+)\s*,\s*(\w+)\s*,\s*(\w+)\s*\}', src, re.S)
+    if not m:
+        log_err(f"{path}: no GFXfont")
+    name = m.group(1)
+    first, last, y_advance = (int(v, 0) for v in m.group(2, 3, 4))
+    return name, bitmap, glyphs, first, last, y_advance
+
+def glyph_pixels(bitmap, offset, w, h):
+    bits = []
+    for i in range(w * h):
+        byte = bitmap[offset + (i >> 3)]
+        bits.append((byte >> (7 - (i & 7))) & 1)
+    return bits
+
+def to_pages(bits, w, h):
+    out = []
+    for page in range((h + 7) // 8):
+        for x in range(w):
+            b = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < h and bits[y * w + x]:
+                    b |= 1 << bit
+            out.append(b)
+    return out
+
+def convert(path, outdir):
+    name, bitmap, glyphs, first, last, y_advance = parse_font(path)
+    if len(glyphs) != last - first + 1:
+        log_err(f"{path}: {len(glyphs)} glyphs for 0x{first:02X}..0x{last:02X}")
+
+    paged = []
+    new_glyphs = []
+    for offset, w, h, xadv, xo, yo in glyphs:
+        new_glyphs.append((len(paged), w, h, xadv, xo, yo))
+        if w and h:
+            paged += to_pages(glyph_pixels(bitmap, offset, w, h), w, h)
+
+    lines = [
+        f"// Generated by toolchain/font_atlas.py from fonts/{os.path.basename(path)}, do not edit.",
+        "// Page layout: per glyph ceil(height / 8) strips of width column bytes, LSB on top.",
+        '#include "../../gfxfont.h"',
+        "",
+        f"const uint8_t {name}PageBitmaps[] PROGMEM = {{",
+    ]
+    for i in range(0, len(paged), 12):
+        lines.append("    " + " ".join(f"0x{b:02X}," for b in paged[i:i + 12]))
+    lines += ["};", "", f"const GFXglyph {name}PageGlyphs[] PROGMEM = {{"]
+    for i, g in enumerate(new_glyphs):
+        c = first + i
+        ch = chr(c) if 0x20 < c < 0x7F and c != 0x5C else ' '
+        lines.append(f"    {{{g[0]:5}, {g[1]:3}, {g[2]:3}, {g[3]:3}, {g[4]:4}, {g[5]:4}}}, // 0x{c:02X} '{ch}'")
+    lines += [
+        "};",
+        "",
+        f"const GFXfont {name} PROGMEM = {{(uint8_t *){name}PageBitmaps,",
+        f"    (GFXglyph *){name}PageGlyphs, 0x{first:02X}, 0x{last:02X}, {y_advance}}};",
+        "",
+    ]
+
+    out = os.path.join(outdir, os.path.basename(path))
+    with open(out, 'w') as f:
+        f.write("\n".join(lines))
+    log_ok(f"{name}: {len(bitmap)} -> {len(paged)} bytes, {out}")
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert GFXfont headers to page-layout glyph strips")
+    parser.add_argument('fonts', nargs='+', help="GFXfont headers")
+    parser.add_argument('-o', '--outdir', default='src/ui/fonts/paged')
+    args = parser.parse_args()
+
+    print(f"\n  ⚡ {BOLD}deltafw Font Atlas{RESET}\n")
+    os.makedirs(args.outdir, exist_ok=True)
+    for path in args.fonts:
+        convert(path, args.outdir)
+
+if __name__ == '__main__':
+    main()
@@ -18,13 +18,20 @@ FEATURES = {
     "ENABLE_UART": {"title": "UART", "desc": "Serial UART communication", "category": "Comm", "size": 800, "default": True},
     "ENABLE_USB": {"title": "USB", "desc": "USB CDC virtual COM port", "category": "Comm", "size": 2000, "default": True},
     "ENABLE_AIRCOPY": {"title": "AirCopy", "desc": "Wireless config transfer", "category": "Comm", "size": 1200, "default": False},
+    "ENABLE_AIRCOPY_V2": {"title": "AirCopy v2", "desc": "Record clone with repeats (v2 only)", "category": "Comm", "size": 1900, "default": False},
+    "ENABLE_UART_CMD_CLONE": {"title": "USB Record Clone", "desc": "Clone records over UART/USB", "category": "Comm", "size": 700, "default": False},
     
     # Radio
     "ENABLE_BK1080": {"title": "BK1080 Driver", "desc": "FM receiver chip driver", "category": "Radio", "size": 500, "default": True},
     "ENABLE_FMRADIO": {"title": "FM Radio App", "desc": "WFM broadcast receiver app", "category": "Radio", "size": 1500, "default": True},
+    "ENABLE_FM_SEEK_SCAN": {"title": "FM Seek Scan", "desc": "Fast ranked FM autoscan", "category": "Radio", "size": 600, "default": False},
+    "ENABLE_CW_ENGINE": {"title": "CW 1ms Engine", "desc": "TIM14 keying/decoding, needs CW Keyer", "category": "Radio", "size": 400, "default": False},
+    "ENABLE_FM_DUAL_RX": {"title": "FM Dual RX", "desc": "Watch VFOs under FM", "category": "Radio", "size": 200, "default": False},
     "ENABLE_BK1080_LISTEN_IN_VFO": {"title": "FM Listen in VFO", "desc": "Use BK1080 for FM in standard VFO", "category": "Radio", "size": 200, "default": True},
     "ENABLE_SPECTRUM": {"title": "Spectrum Analyzer", "desc": "RF spectrum view (F+5)", "category": "Radio", "size": 3500, "default": False},
     "ENABLE_SPECTRUM_EXTENSIONS": {"title": "Spectrum Extensions", "desc": "Extra spectrum features", "category": "Radio", "size": 500, "default": True},
+    "ENABLE_SPECTRUM_BANDS": {"title": "Spectrum Band Plans", "desc": "Sweep several bands as one view", "category": "Radio", "size": 700, "default": False},
+    "ENABLE_SPECTRUM_STREAM": {"title": "Spectrum Streaming", "desc": "Stream sweeps to a PC waterfall", "category": "Radio", "size": 600, "default": False},
     "ENABLE_NOAA": {"title": "NOAA Weather", "desc": "NOAA weather channels", "category": "Radio", "size": 200, "default": False},
     "ENABLE_VOX": {"title": "VOX", "desc": "Voice-activated transmit", "category": "Radio", "size": 400, "default": True},
     "ENABLE_VOICE": {"title": "Voice Prompts", "desc": "Spoken announcements", "category": "Radio", "size": 2000, "default": False},
@@ -39,6 +46,7 @@ FEATURES = {
     "ENABLE_CTCSS_TAIL_PHASE_SHIFT": {"title": "CTCSS Tail Phase", "desc": "Tail elimination", "category": "Radio", "size": 150, "default": False},
     "ENABLE_NO_CODE_SCAN_TIMEOUT": {"title": "No Scan Timeout", "desc": "Disable scan timeout", "category": "Radio", "size": 50, "default": True},
     "ENABLE_SCAN_RANGES": {"title": "Scan Ranges", "desc": "Custom scan ranges", "category": "Radio", "size": 300, "default": True},
+    "ENABLE_DCS_FEC": {"title": "DCS Error Fix", "desc": "Golay DCS decode, 1 bit error", "category": "Radio", "size": 150, "default": True},
     "ENABLE_NARROWER_BW_FILTER": {"title": "Narrower BW", "desc": "Narrow bandwidth filter", "category": "Radio", "size": 100, "default": True},
     "ENABLE_BYP_RAW_DEMODULATORS": {"title": "Bypass Raw Demod", "desc": "Raw demod bypass", "category": "Radio", "size": 100, "default": False},
     "ENABLE_REDUCE_LOW_MID_TX_POWER": {"title": "Reduce TX Power", "desc": "Lower power levels", "category": "Radio", "size": 50, "default": False},
@@ -55,6 +63,7 @@ FEATURES = {
     "ENABLE_REVERSE_BAT_SYMBOL": {"title": "Reverse Battery", "desc": "Flip battery icon", "category": "UI", "size": 50, "default": False},
     "ENABLE_SHOW_CHARGE_LEVEL": {"title": "Charge Level", "desc": "Show charging %", "category": "UI", "size": 150, "default": False},
     "ENABLE_USBC_CHARGING_INDICATOR": {"title": "USB-C Indicator", "desc": "USB-C charge status", "category": "UI", "size": 100, "default": False},
+    "ENABLE_BATTERY_MODEL": {"title": "Battery Model", "desc": "Charge + runtime est.", "category": "UI", "size": 900, "default": False},
     "ENABLE_NAVIG_LEFT_RIGHT": {"title": "L/R Navigation", "desc": "Left/right key nav", "category": "UI", "size": 100, "default": True},
     
     # Apps
@@ -80,6 +89,11 @@ FEATURES = {
     # Debug
     "ENABLE_SERIAL_SCREENCAST": {"title": "Screencast", "desc": "Stream display", "category": "Debug", "size": 600, "default": False},
     "ENABLE_SWD": {"title": "SWD Debug", "desc": "SWD interface", "category": "Debug", "size": 100, "default": False},
+    "ENABLE_BK4819_IRQ": {"title": "BK4819 IRQ Line", "desc": "EXTI radio events (PB7 mod)", "category": "Debug", "size": 200, "default": False},
+    "ENABLE_KEYPAD_IRQ": {"title": "Keypad IRQ", "desc": "EXTI keypad wake", "category": "Debug", "size": 400, "default": False},
+    "ENABLE_ADC_DMA": {"title": "ADC DMA Scan", "desc": "Oversampled batt/temp", "category": "Debug", "size": 500, "default": False},
+    "ENABLE_ASYNC_FLASH": {"title": "Async SPI Flash", "desc": "Erase/program in the background", "category": "Debug", "size": 300, "default": False},
+    "ENABLE_STOP_MODE": {"title": "STOP Power Save", "desc": "LPTIM wake, needs Keypad IRQ", "category": "Debug", "size": 500, "default": False},
     "ENABLE_UART_RW_BK_REGS": {"title": "UART BK Regs", "desc": "BK4819 via UART", "category": "Debug", "size": 300, "default": False},
     "ENABLE_FIRMWARE_DEBUG_LOGGING": {"title": "Debug Logging", "desc": "Debug output", "category": "Debug", "size": 400, "default": False},
     "ENABLE_AM_FIX_SHOW_DATA": {"title": "AM Fix Data", "desc": "AM fix debug", "category": "Debug", "size": 200, "default": False},
@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+"""
+Voice Prompt Packer
+Builds the SPI flash image for REC_VOICE_PROMPT_DATA / REC_VOICE_CLIP_DATA
+with IMA-ADPCM encoded clips.
+
+Image layout (flash it at 0x14C000):
+  0x0000  prompt table, Chinese   (8 bytes per voice ID: offset, size)
+  0x0800  prompt table, English
+  0x1000  clip data (REC_VOICE_CLIP_DATA, offsets in the tables are relative)
+
+Bit 31 of the size marks an ADPCM clip, size counts bytes (two samples each).
+Input clips are 8 kHz mono 16-bit WAV files named after the voice ID,
+e.g. en/00.wav .. en/4A.wav (hex).
+"""
+
+import argparse
+import os
+import struct
+import sys
+import wave
+
+RESET = "\033[0m"
+BOLD = "\033[1m"
+INVERT = "\033[7m"
+RED = "\033[31m"
+GREEN = "\033[32m"
+YELLOW = "\033[33m"
+BLUE = "\033[34m"
+
+def log_info(msg):    print(f"{BLUE}{INVERT} INFO {RESET} {msg}")
+def log_ok(msg):      print(f"{GREEN}{INVERT}  OK  {RESET} {msg}")
+def log_warn(msg):    print(f"{YELLOW}{INVERT} WARN {RESET} {msg}")
+def log_err(msg):     print(f"{RED}{INVERT} FAIL {RESET} {msg}"); sys.exit(1)
+
+# Must match src/features/storage/storage.h and src/features/audio/audio.*
+FLASH_BASE     = 0x14C000
+TABLE_STRIDE   = 0x800
+CLIP_BASE      = 0x1000
+FLASH_END      = 0x200000
+VOICE_ID_END   = 0x4B
+CLIP_ADPCM     = 0x80000000
+CLIP_MAX_OFFSET = 0x0B0000    # LoadVoiceClip() refuses anything past these
+CLIP_MAX_SIZE   = 0x019000
+SAMPLE_RATE    = 8000
+LANGUAGES      = ('zh', 'en')  # table order: REC_VOICE_PROMPT_DATA index 0, 1
+
+ADPCM_INDEX = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+ADPCM_STEP = [
+        7,     8,     9,    10,    11,    12,    13,    14,    16,    17,
+       19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+       50,    55,    60,    66,    73,    80,    88,    97,   107,   118,
+      130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+      337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+      876,   963,  1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+     2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+     5894,  6484,  7132,  7845,  8630,  9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+]
+
+def adpcm_encode(samples):
+    """IMA-ADPCM, low nibble first. Mirrors DecodeAdpcm() in audio.c."""
+    predictor, index = 0, 0
+    out = bytearray()
+    for n, sample in enumerate(samples):
+        step = ADPCM_STEP[index]
+        diff = sample - predictor
+        code = 0
+        if diff < 0:
+            code = 8
+            diff = -diff
+        delta = step >> 3
+        if diff >= step:
+            code |= 4
+            diff -= step
+            delta += step
+        if diff >= step >> 1:
+            code |= 2
+            diff -= step >> 1
+            delta += step >> 1
+        if diff >= step >> 2:
+            code |= 1
+            delta += step >> 2
+
+        predictor += -delta if code & 8 else delta
+        predictor = max(-32768, min(32767, predictor))
+        index = max(0, min(88, index + ADPCM_INDEX[code]))
+
+        if n & 1:
+            out[-1] |= code << 4
+        else:
+            out.append(code)
+    return bytes(out)
+
+def read_wav(path):
+    with wave.open(path, 'rb') as w:
+        if w.getnchannels() != 1 or w.getsampwidth() != 2 or w.getframerate() != SAMPLE_RATE:
+            log_err(f"{path}: need {SAMPLE_RATE} Hz mono 16-bit PCM")
+        frames = w.readframes(w.getnframes())
+    return struct.unpack(f"<{len(frames) // 2}h", frames)
+
+def load_language(directory):
+    clips = {}
+    if not directory:
+        return clips
+    for name in sorted(os.listdir(directory)):
+        stem, ext = os.path.splitext(name)
+        if ext.lower() != '.wav':
+            continue
+        try:
+            voice_id = int(stem, 16)
+        except ValueError:
+            log_warn(f"{name}: not a hex voice ID, skipped")
+            continue
+        if voice_id >= VOICE_ID_END:
+            log_warn(f"{name}: voice ID out of range, skipped")
+            continue
+        clips[voice_id] = read_wav(os.path.join(directory, name))
+    return clips
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack voice prompts into an IMA-ADPCM flash image")
+    parser.add_argument('--zh', help="directory of Chinese prompt WAVs")
+    parser.add_argument('--en', help="directory of English prompt WAVs")
+    parser.add_argument('-o', '--output', required=True, help="image to flash at 0x%06X" % FLASH_BASE)
+    args = parser.parse_args()
+
+    print(f"\n  ⚡ {BOLD}deltafw Voice Packer{RESET}\n")
+
+    image = bytearray(b'\xff' * CLIP_BASE)
+    # offset 0 reads as "no clip" on the radio, keep the first clip off it
+    data = bytearray(b'\xff' * 16)
+    pcm_bytes = 0
+
+    for table, lang in enumerate(LANGUAGES):
+        clips = load_language(getattr(args, lang))
+        for voice_id, samples in sorted(clips.items()):
+            encoded = adpcm_encode(samples)
+            if len(encoded) > CLIP_MAX_SIZE:
+                log_err(f"{lang}/{voice_id:02X}.wav: {len(encoded)} bytes encoded, the radio plays at most {CLIP_MAX_SIZE}")
+            if len(data) > CLIP_MAX_OFFSET:
+                log_err(f"{lang}/{voice_id:02X}.wav: starts at clip offset 0x{len(data):06X}, the radio reads up to 0x{CLIP_MAX_OFFSET:06X}")
+            entry = table * TABLE_STRIDE + 8 * voice_id
+            image[entry:entry + 8] = struct.pack('<II', len(data), len(encoded) | CLIP_ADPCM)
+            data += encoded
+            pcm_bytes += 2 * len(samples)
+        log_info(f"{lang}: {len(clips)} prompts")
+
+    image += data
+    if FLASH_BASE + len(image) > FLASH_END:
+        log_err(f"image is {len(image)} bytes, {FLASH_BASE + len(image) - FLASH_END} past the end of flash")
+
+    with open(args.output, 'wb') as f:
+        f.write(image)
+
+    ratio = pcm_bytes / max(1, len(data))
+    log_ok(f"{args.output}: {len(image)} bytes, clips {len(data)} bytes ({ratio:.1f}x smaller than 16-bit PCM)")
+
+if __name__ == '__main__':
+    main()